@@ -27,6 +27,8 @@ public class Credits : ModuleRules
 			new string[]
 			{
 				"Core",
+				"SlateCore",
+				"UMG",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -35,10 +37,15 @@ public class Credits : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"AssetRegistry",
+				"AudioMixer",
 				"CoreUObject",
 				"Engine",
+				"Json",
+				"Projects",
+				"RenderCore",
+				"RHI",
 				"Slate",
-				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,272 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsAssetStreamer.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Texture2D.h"
+#include "CreditsCompiler.h"
+#include "CreditsStats.h"
+
+/** Weight of the latest scroll speed sample, smoothing out frame time spikes. */
+static const float CreditsScrollSpeedSmoothing = 0.25f;
+
+FCreditsAssetStreamer::FCreditsAssetStreamer(const TSharedRef<FCreditsCompiledCredits>& InCredits)
+	: Credits(InCredits)
+	, LookaheadSeconds(5.0f)
+	, KeepBehindDistance(0.0f)
+	, LastScrollOffset(0.0f)
+	, ScrollSpeed(0.0f)
+	, MaxImageExtent(0.0f)
+	, ActiveFirst(0)
+	, ActiveEnd(0)
+	, bHasUpdated(false)
+	, bExtentsRefreshed(false)
+{
+	RefreshExtents();
+#if STATS
+	NumLoadedStat = 0;
+	StatsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCreditsAssetStreamer::TickStats));
+#endif
+}
+
+FCreditsAssetStreamer::~FCreditsAssetStreamer()
+{
+	ReleaseAll();
+#if STATS
+	FTSTicker::GetCoreTicker().RemoveTicker(StatsTickerHandle);
+	DEC_DWORD_STAT_BY(STAT_CreditsLoadedTextures, NumLoadedStat);
+#endif
+}
+
+void FCreditsAssetStreamer::RefreshExtents()
+{
+	// images are only ever appended, so the handles of the existing ones stay valid.
+	const int32 NumImages = Credits->Images.Num();
+	ImageTops.Init(FLT_MAX, NumImages);
+	ImageBottoms.Init(-FLT_MAX, NumImages);
+	Handles.SetNum(NumImages);
+
+	// every line showing a soft image widens the extent of that image, hard images keep an empty extent.
+	const FCreditsLineTable& Lines = Credits->Lines;
+	for (int32 Line = 0; Line < Lines.Num(); ++Line)
+	{
+		const int32 ImageIndex = Lines.ImageIndices[Line];
+		if (ImageIndex == INDEX_NONE || !Credits->SoftImages[ImageIndex])
+		{
+			continue;
+		}
+		ImageTops[ImageIndex] = FMath::Min(ImageTops[ImageIndex], Lines.OffsetsY[Line]);
+		ImageBottoms[ImageIndex] = FMath::Max(ImageBottoms[ImageIndex], Lines.OffsetsY[Line] + Lines.Heights[Line]);
+	}
+
+	// the soft images shown by a line in order of their top, so the ones around a window are a range found by binary search.
+	SortedImages.Reset();
+	MaxImageExtent = 0.0f;
+	for (int32 ImageIndex = 0; ImageIndex < NumImages; ++ImageIndex)
+	{
+		if (ImageTops[ImageIndex] <= ImageBottoms[ImageIndex])
+		{
+			SortedImages.Add(ImageIndex);
+			MaxImageExtent = FMath::Max(MaxImageExtent, ImageBottoms[ImageIndex] - ImageTops[ImageIndex]);
+		}
+	}
+	SortedImages.Sort([this](int32 A, int32 B) { return ImageTops[A] < ImageTops[B]; });
+
+	// the previous range is in the old order, so the next update looks at every image once.
+	ActiveFirst = 0;
+	ActiveEnd = 0;
+	bExtentsRefreshed = true;
+}
+
+void FCreditsAssetStreamer::RemapImages(const TArray<int32>& ImageRemap)
+{
+	TArray<TSharedPtr<FStreamableHandle>> OldHandles = MoveTemp(Handles);
+	Handles.SetNum(Credits->Images.Num());
+	for (int32 ImageIndex = 0; ImageIndex < OldHandles.Num() && ImageIndex < ImageRemap.Num(); ++ImageIndex)
+	{
+		TSharedPtr<FStreamableHandle>& Handle = OldHandles[ImageIndex];
+		if (ImageRemap[ImageIndex] != INDEX_NONE)
+		{
+			Handles[ImageRemap[ImageIndex]] = MoveTemp(Handle);
+		}
+		else if (Handle.IsValid())
+		{
+			// the image left the credits with its lines, there is no brush left to clear.
+			if (Handle->IsLoadingInProgress())
+			{
+				Handle->CancelHandle();
+			}
+			else
+			{
+				Handle->ReleaseHandle();
+			}
+		}
+	}
+	RefreshExtents();
+}
+
+void FCreditsAssetStreamer::SetWindow(float InLookaheadSeconds, float InKeepBehindDistance)
+{
+	LookaheadSeconds = FMath::Max(0.0f, InLookaheadSeconds);
+	KeepBehindDistance = FMath::Max(0.0f, InKeepBehindDistance);
+}
+
+void FCreditsAssetStreamer::Update(float ScrollOffset, float ViewportHeight, float DeltaTime)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsStreamImages);
+
+	if (bHasUpdated && DeltaTime > 0.0f)
+	{
+		const float Speed = (ScrollOffset - LastScrollOffset) / DeltaTime;
+		ScrollSpeed += (Speed - ScrollSpeed) * CreditsScrollSpeedSmoothing;
+	}
+	LastScrollOffset = ScrollOffset;
+	bHasUpdated = true;
+
+	// the lookahead follows the scroll direction, so rewinding credits stream in above the viewport.
+	const float Lookahead = ScrollSpeed * LookaheadSeconds;
+	const float WindowTop = ScrollOffset - KeepBehindDistance + FMath::Min(0.0f, Lookahead);
+	const float WindowBottom = ScrollOffset + ViewportHeight + FMath::Max(0.0f, Lookahead);
+
+	auto UpdateImage = [this, WindowTop, WindowBottom](int32 ImageIndex)
+	{
+		// a soft image already loaded when the credits were compiled is resident without a handle.
+		const bool bInWindow = ImageTops[ImageIndex] < WindowBottom && ImageBottoms[ImageIndex] > WindowTop;
+		if (bInWindow && !Handles[ImageIndex].IsValid())
+		{
+			RequestImage(ImageIndex);
+		}
+		else if (!bInWindow && (Handles[ImageIndex].IsValid() || Credits->Images[ImageIndex] != nullptr))
+		{
+			ReleaseImage(ImageIndex);
+		}
+	};
+
+	// no image starting above the window by more than the longest extent reaches into it.
+	const auto GetImageTop = [this](int32 ImageIndex) { return ImageTops[ImageIndex]; };
+	const int32 First = Algo::LowerBoundBy(SortedImages, WindowTop - MaxImageExtent, GetImageTop);
+	const int32 End = Algo::LowerBoundBy(SortedImages, WindowBottom, GetImageTop);
+
+	// only the images of the previous range can have left the window, unless the extents changed since.
+	if (bExtentsRefreshed)
+	{
+		for (int32 ImageIndex = 0; ImageIndex < Handles.Num(); ++ImageIndex)
+		{
+			if (Credits->SoftImages[ImageIndex])
+			{
+				UpdateImage(ImageIndex);
+			}
+		}
+		bExtentsRefreshed = false;
+	}
+	else
+	{
+		for (int32 SortedIndex = ActiveFirst; SortedIndex < ActiveEnd; ++SortedIndex)
+		{
+			if (SortedIndex < First || SortedIndex >= End)
+			{
+				UpdateImage(SortedImages[SortedIndex]);
+			}
+		}
+	}
+
+	for (int32 SortedIndex = First; SortedIndex < End; ++SortedIndex)
+	{
+		const int32 ImageIndex = SortedImages[SortedIndex];
+		UpdateImage(ImageIndex);
+	}
+	ActiveFirst = First;
+	ActiveEnd = End;
+}
+
+void FCreditsAssetStreamer::ReleaseAll()
+{
+	for (int32 ImageIndex = 0; ImageIndex < Handles.Num(); ++ImageIndex)
+	{
+		if (Credits->SoftImages[ImageIndex] && (Handles[ImageIndex].IsValid() || Credits->Images[ImageIndex] != nullptr))
+		{
+			ReleaseImage(ImageIndex);
+		}
+	}
+}
+
+int32 FCreditsAssetStreamer::GetNumResidentImages() const
+{
+	int32 NumResident = 0;
+	for (const TSharedPtr<FStreamableHandle>& Handle : Handles)
+	{
+		NumResident += Handle.IsValid() ? 1 : 0;
+	}
+	return NumResident;
+}
+
+void FCreditsAssetStreamer::RequestImage(int32 ImageIndex)
+{
+	const FSoftObjectPath& Path = Credits->ImagePaths[ImageIndex];
+	TWeakPtr<FCreditsCompiledCredits> WeakCredits = Credits;
+
+	// the image is found by its path once loaded, the credits may have compacted their images in the meantime.
+	Handles[ImageIndex] = GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate::CreateLambda([WeakCredits, Path]()
+	{
+		TSharedPtr<FCreditsCompiledCredits> PinnedCredits = WeakCredits.Pin();
+		UTexture2D* Texture = Cast<UTexture2D>(Path.ResolveObject());
+		const int32* FoundImage = PinnedCredits.IsValid() ? PinnedCredits->ImageLookup.Find(Path) : nullptr;
+		if (FoundImage == nullptr || Texture == nullptr)
+		{
+			return;
+		}
+
+		PinnedCredits->SetImage(*FoundImage, Texture);
+	}));
+}
+
+void FCreditsAssetStreamer::ReleaseImage(int32 ImageIndex)
+{
+	TSharedPtr<FStreamableHandle> Handle = MoveTemp(Handles[ImageIndex]);
+	if (Handle.IsValid())
+	{
+		if (Handle->IsLoadingInProgress())
+		{
+			Handle->CancelHandle();
+		}
+		else
+		{
+			Handle->ReleaseHandle();
+		}
+	}
+
+	// dropping the compiled credits reference lets the texture be collected.
+	Credits->SetImage(ImageIndex, nullptr);
+}
+
+#if STATS
+bool FCreditsAssetStreamer::TickStats(float DeltaTime)
+{
+	// every streamer adds its own images to the stat, so several rollers sum up.
+	int32 NumLoaded = 0;
+	for (int32 ImageIndex = 0; ImageIndex < Credits->Images.Num(); ++ImageIndex)
+	{
+		NumLoaded += Credits->SoftImages[ImageIndex] && Credits->Images[ImageIndex] != nullptr ? 1 : 0;
+	}
+	if (NumLoaded > NumLoadedStat)
+	{
+		INC_DWORD_STAT_BY(STAT_CreditsLoadedTextures, NumLoaded - NumLoadedStat);
+	}
+	else if (NumLoaded < NumLoadedStat)
+	{
+		DEC_DWORD_STAT_BY(STAT_CreditsLoadedTextures, NumLoadedStat - NumLoaded);
+	}
+	NumLoadedStat = NumLoaded;
+	return true;
+}
+#endif
+
+FStreamableManager& FCreditsAssetStreamer::GetStreamableManager()
+{
+	if (UAssetManager::IsValid())
+	{
+		return UAssetManager::GetStreamableManager();
+	}
+	static FStreamableManager StreamableManager;
+	return StreamableManager;
+}
@@ -0,0 +1,243 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsBenchmarkCommandlet.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "CreditsBinary.h"
+#include "CreditsCompiler.h"
+#include "CreditsConverter.h"
+#include "CreditsLayout.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsSynthetic.h"
+
+/** Milliseconds, megabytes or kilobytes a measurement may grow by whatever the tolerance, below which it is noise. */
+static const double CreditsBenchmarkNoiseFloor = 1.0;
+
+static const TCHAR* CreditsBenchmarkCsvHeader = TEXT("Names,Sections,Lines,Styles,OverrideDensity,ImageRatio,ConvertMs,CompileMs,LayoutMs,Measured,PeakMemoryMB,CompiledKB,BinaryKB");
+
+UCreditsBenchmarkCommandlet::UCreditsBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UCreditsBenchmarkCommandlet::Main(const FString& Params)
+{
+	FCreditsSyntheticSettings Settings;
+	FParse::Value(*Params, TEXT("OverrideDensity="), Settings.OverrideDensity);
+	FParse::Value(*Params, TEXT("ImageRatio="), Settings.ImageRatio);
+
+	FString NamesList = TEXT("1000,10000,100000,1000000");
+	FParse::Value(*Params, TEXT("Names="), NamesList, false);
+	TArray<int32> NameCounts;
+	TArray<FString> NameCountStrings;
+	NamesList.ParseIntoArray(NameCountStrings, TEXT(","));
+	for (const FString& NameCount : NameCountStrings)
+	{
+		NameCounts.Add(FMath::Max(1, FCString::Atoi(*NameCount)));
+	}
+
+	// from the smallest run up, so each run can raise the high water mark its peak memory is read from.
+	NameCounts.Sort();
+
+	FString Output = FPaths::ProjectSavedDir() / TEXT("Credits") / TEXT("CreditsBenchmark.csv");
+	FParse::Value(*Params, TEXT("Output="), Output);
+
+	TArray<FCreditsScaleResult> Results;
+	for (const int32 NameCount : NameCounts)
+	{
+		Settings.NumNames = NameCount;
+		const FCreditsScaleResult& Result = Results.Add_GetRef(RunScale(Settings));
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("CreditsBenchmark: %d names, %d lines, %d styles, convert %.3f ms, compile %.3f ms, layout (%s) %.3f ms, peak memory %.1f MB, compiled %.1f KB, binary %.1f KB"),
+			Result.NumNames, Result.NumLines, Result.NumStyles, Result.ConvertMs, Result.CompileMs, Result.bMeasured ? TEXT("measured") : TEXT("estimated"), Result.LayoutMs,
+			Result.PeakMemoryMB, Result.CompiledKB, Result.BinaryKB);
+
+		// the next run starts from the memory this one held.
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	if (!WriteCsv(Results, Output))
+	{
+		UE_LOG(ClosingCreditsLog, Error, TEXT("CreditsBenchmark: could not write %s"), *Output);
+		return 1;
+	}
+	UE_LOG(ClosingCreditsLog, Display, TEXT("CreditsBenchmark: wrote %s"), *Output);
+
+	FString BaselineFile;
+	if (!FParse::Value(*Params, TEXT("Baseline="), BaselineFile))
+	{
+		return 0;
+	}
+
+	TArray<FCreditsScaleResult> Baseline;
+	if (!ReadCsv(BaselineFile, Baseline))
+	{
+		UE_LOG(ClosingCreditsLog, Error, TEXT("CreditsBenchmark: could not read the baseline %s"), *BaselineFile);
+		return 1;
+	}
+
+	float Tolerance = 0.2f;
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+	const int32 NumRegressions = CompareToBaseline(Results, Baseline, Tolerance);
+	UE_LOG(ClosingCreditsLog, Display, TEXT("CreditsBenchmark: %d regressions against %s"), NumRegressions, *BaselineFile);
+	return NumRegressions > 0 ? 1 : 0;
+}
+
+FCreditsScaleResult UCreditsBenchmarkCommandlet::RunScale(const FCreditsSyntheticSettings& Settings)
+{
+	// the samples between stages miss the peaks inside them, which the process high water mark catches whenever
+	// the run sets a new one, as the largest runs do.
+	const FPlatformMemoryStats StartStats = FPlatformMemory::GetStats();
+	const uint64 StartMemory = StartStats.UsedPhysical;
+	uint64 PeakMemory = StartMemory;
+	auto SampleMemory = [&PeakMemory]()
+	{
+		PeakMemory = FMath::Max<uint64>(PeakMemory, FPlatformMemory::GetStats().UsedPhysical);
+	};
+
+	FCreditsSyntheticCredits Synthetic;
+	Synthetic.Generate(Settings);
+	SampleMemory();
+
+	FCreditsScaleResult Result;
+	Result.NumNames = Synthetic.GetNumNames();
+	Result.OverrideDensity = Settings.OverrideDensity;
+	Result.ImageRatio = Settings.ImageRatio;
+
+	// the override index is built from the override rows as part of the conversion.
+	double StartTime = FPlatformTime::Seconds();
+	FCreditsOverrideIndex Overrides;
+	Overrides.Build(Synthetic.RoleOverrides, Synthetic.NameOverrides);
+	TArray<FCreditsSection> Sections;
+	FCreditsConverter::ConvertSections(Synthetic.Sections, Overrides.IsEmpty() ? nullptr : &Overrides, Sections);
+	Result.ConvertMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	SampleMemory();
+
+	FCreditsCompiledCredits Compiled;
+	StartTime = FPlatformTime::Seconds();
+	FCreditsCompiler::Compile(Sections, Compiled);
+	Result.CompileMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	SampleMemory();
+
+	StartTime = FPlatformTime::Seconds();
+	Result.bMeasured = FCreditsLayout::Layout(Compiled);
+	Result.LayoutMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	SampleMemory();
+
+	TArray<uint8> Binary;
+	FCreditsBinary::Write(Compiled, Binary);
+	SampleMemory();
+
+	Result.NumSections = Compiled.Lines.SectionStarts.Num();
+	Result.NumLines = Compiled.Lines.Num();
+	Result.NumStyles = Compiled.Styles.Num();
+	const uint64 EndPeakMemory = FPlatformMemory::GetStats().PeakUsedPhysical;
+	if (EndPeakMemory > StartStats.PeakUsedPhysical)
+	{
+		PeakMemory = FMath::Max(PeakMemory, EndPeakMemory);
+	}
+	Result.PeakMemoryMB = (PeakMemory - StartMemory) / (1024.0 * 1024.0);
+	Result.CompiledKB = Compiled.GetAllocatedSize() / 1024.0;
+	Result.BinaryKB = Binary.Num() / 1024.0;
+	return Result;
+}
+
+bool UCreditsBenchmarkCommandlet::WriteCsv(const TArray<FCreditsScaleResult>& Results, const FString& Filename)
+{
+	FString Csv = CreditsBenchmarkCsvHeader;
+	Csv += LINE_TERMINATOR;
+	for (const FCreditsScaleResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%d,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.3f,%.3f,%.3f"),
+			Result.NumNames, Result.NumSections, Result.NumLines, Result.NumStyles, Result.OverrideDensity, Result.ImageRatio,
+			Result.ConvertMs, Result.CompileMs, Result.LayoutMs, Result.bMeasured ? 1 : 0, Result.PeakMemoryMB, Result.CompiledKB, Result.BinaryKB);
+		Csv += LINE_TERMINATOR;
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Filename);
+}
+
+bool UCreditsBenchmarkCommandlet::ReadCsv(const FString& Filename, TArray<FCreditsScaleResult>& OutResults)
+{
+	TArray<FString> Rows;
+	if (!FFileHelper::LoadFileToStringArray(Rows, *Filename) || Rows.Num() == 0 || Rows[0] != CreditsBenchmarkCsvHeader)
+	{
+		return false;
+	}
+
+	OutResults.Reset();
+	for (int32 Row = 1; Row < Rows.Num(); ++Row)
+	{
+		TArray<FString> Values;
+		if (Rows[Row].ParseIntoArray(Values, TEXT(","), false) != 13)
+		{
+			continue;
+		}
+
+		FCreditsScaleResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.NumNames = FCString::Atoi(*Values[0]);
+		Result.NumSections = FCString::Atoi(*Values[1]);
+		Result.NumLines = FCString::Atoi(*Values[2]);
+		Result.NumStyles = FCString::Atoi(*Values[3]);
+		Result.OverrideDensity = FCString::Atof(*Values[4]);
+		Result.ImageRatio = FCString::Atof(*Values[5]);
+		Result.ConvertMs = FCString::Atod(*Values[6]);
+		Result.CompileMs = FCString::Atod(*Values[7]);
+		Result.LayoutMs = FCString::Atod(*Values[8]);
+		Result.bMeasured = FCString::Atoi(*Values[9]) != 0;
+		Result.PeakMemoryMB = FCString::Atod(*Values[10]);
+		Result.CompiledKB = FCString::Atod(*Values[11]);
+		Result.BinaryKB = FCString::Atod(*Values[12]);
+	}
+	return true;
+}
+
+int32 UCreditsBenchmarkCommandlet::CompareToBaseline(const TArray<FCreditsScaleResult>& Results, const TArray<FCreditsScaleResult>& Baseline, float Tolerance)
+{
+	int32 NumRegressions = 0;
+	for (const FCreditsScaleResult& Result : Results)
+	{
+		const FCreditsScaleResult* Base = Baseline.FindByPredicate([&Result](const FCreditsScaleResult& Candidate)
+		{
+			return Candidate.NumNames == Result.NumNames
+				&& FMath::IsNearlyEqual(Candidate.OverrideDensity, Result.OverrideDensity, 0.001f)
+				&& FMath::IsNearlyEqual(Candidate.ImageRatio, Result.ImageRatio, 0.001f);
+		});
+		if (Base == nullptr)
+		{
+			UE_LOG(ClosingCreditsLog, Display, TEXT("CreditsBenchmark: no baseline for %d names"), Result.NumNames);
+			continue;
+		}
+
+		auto Compare = [&NumRegressions, &Result, Tolerance](const TCHAR* Name, double Value, double BaseValue)
+		{
+			if (Value > BaseValue * (1.0 + Tolerance) && Value - BaseValue > CreditsBenchmarkNoiseFloor)
+			{
+				UE_LOG(ClosingCreditsLog, Warning, TEXT("CreditsBenchmark: %d names, %s regressed from %.3f to %.3f (+%.0f%%)"),
+					Result.NumNames, Name, BaseValue, Value, BaseValue > 0.0 ? (Value / BaseValue - 1.0) * 100.0 : 100.0);
+				++NumRegressions;
+			}
+		};
+
+		Compare(TEXT("ConvertMs"), Result.ConvertMs, Base->ConvertMs);
+		Compare(TEXT("CompileMs"), Result.CompileMs, Base->CompileMs);
+
+		// a measured layout is not comparable with an estimated one.
+		if (Result.bMeasured == Base->bMeasured)
+		{
+			Compare(TEXT("LayoutMs"), Result.LayoutMs, Base->LayoutMs);
+		}
+		Compare(TEXT("PeakMemoryMB"), Result.PeakMemoryMB, Base->PeakMemoryMB);
+		Compare(TEXT("CompiledKB"), Result.CompiledKB, Base->CompiledKB);
+		Compare(TEXT("BinaryKB"), Result.BinaryKB, Base->BinaryKB);
+	}
+	return NumRegressions;
+}
@@ -0,0 +1,973 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/ObjectReader.h"
+#include "Serialization/ObjectWriter.h"
+#include "Engine/DataTable.h"
+#include "Engine/Font.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "CreditsBenchmarkCommandlet.h"
+#include "CreditsBinary.h"
+#include "CreditsBlueprintLibrary.h"
+#include "CreditsBuilder.h"
+#include "CreditsCompiler.h"
+#include "CreditsConverter.h"
+#include "CreditsCurveTable.h"
+#include "CreditsDefaultAssets.h"
+#include "CreditsImporter.h"
+#include "CreditsIncrementalCompiler.h"
+#include "CreditsLayout.h"
+#include "CreditsLazyCompiler.h"
+#include "CreditsManager.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsStyleResolver.h"
+#include "CreditsSynthetic.h"
+
+/**
+ * Closing credits micro-benchmarks.
+ * Each benchmark is a console command that logs its timings to ClosingCreditsLog.
+ */
+#if !UE_BUILD_SHIPPING
+
+namespace CreditsBenchmarks
+{
+	/** Parses the first console argument as a count, falling back to the default. */
+	static int32 ParseCount(const TArray<FString>& Args, int32 DefaultCount)
+	{
+		return Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : DefaultCount;
+	}
+
+	/**
+	 * A copy of the credits structs as they were before the default assets were shared, each resolving its own
+	 * defaults by object path in its member initializers, kept to time and size the old constructor path against.
+	 */
+	namespace Legacy
+	{
+		struct FTextProperties
+		{
+			UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
+			UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FTextProperties()
+				: Title(FString()), Font(DefaultFont), FontMaterial(DefaultFontMaterial), FontSize(24), Color(1.0f, 1.0f, 1.0f, 1.0f)
+			{}
+
+			FTextProperties(const FString InTitle, UFont* InFont, UMaterialInterface* InFontMaterial, int InFontSize, const FLinearColor& InColor)
+				: Title(InTitle), Font(InFont), FontMaterial(InFontMaterial), FontSize(InFontSize), Color(InColor)
+			{}
+
+			FString Title;
+			UFont* Font;
+			UMaterialInterface* FontMaterial;
+			int FontSize;
+			FLinearColor Color;
+		};
+
+		struct FImageProperties
+		{
+			UTexture2D* DefaultImage = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FImageProperties()
+				: Image(DefaultImage), ImageSizeOverride(false), ImageSizeProperties(0.0f, 0.0f)
+			{}
+
+			FImageProperties(UTexture2D* InImage, bool InImageSizeOverride, FVector2D InImageSizeProperties)
+				: Image(InImage), ImageSizeOverride(InImageSizeOverride), ImageSizeProperties(InImageSizeProperties)
+			{}
+
+			UTexture2D* Image;
+			bool ImageSizeOverride;
+			FVector2D ImageSizeProperties;
+		};
+
+		struct FTextObject
+		{
+			UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
+			UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+			UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FTextObject(const FTextProperties& InTextProperties, const FImageProperties& InImageProperties, const FCreditsPaddingMargin& InPadding)
+				: TextProperties(InTextProperties), ImageProperties(InImageProperties), Padding(InPadding)
+			{}
+
+			FTextProperties TextProperties;
+			FImageProperties ImageProperties;
+			FCreditsPaddingMargin Padding;
+		};
+
+		struct FNameTextObject
+		{
+			UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
+			UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+			UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FNameTextObject()
+				: TextProperties(FTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.9f, 0.9f, 0.9f, 1.0f)))
+				, ImageProperties(FImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)))
+				, Padding(FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 10.0f))
+			{}
+
+			FTextProperties TextProperties;
+			FImageProperties ImageProperties;
+			FCreditsPaddingMargin Padding;
+		};
+
+		struct FRoleDefaults
+		{
+			UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
+			UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+			UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FRoleDefaults(const FTextObject& InRole, const ECreditsTextPosition& InRolePosition, bool InDisplayRoleName)
+				: Role(InRole), RolePosition(InRolePosition), DisplayRoleName(InDisplayRoleName)
+			{}
+
+			FTextObject Role;
+			ECreditsTextPosition RolePosition;
+			bool DisplayRoleName;
+		};
+
+		struct FRole
+		{
+			UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
+			UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+			UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
+
+			FRole()
+				: RoleProperties(
+					FRoleDefaults(
+						FTextObject(
+							FTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
+							FImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+							FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 0.0f)
+						),
+						ECreditsTextPosition(ECreditsTextPosition::Side),
+						true
+					)
+				)
+				, PlayedByNames()
+			{}
+
+			FRoleDefaults RoleProperties;
+			TArray<FNameTextObject> PlayedByNames;
+		};
+	}
+
+	/** Times constructing Count FCreditsRole against the shared default assets and against the old constructor path, and compares their sizes. */
+	static void DefaultAssets(const TArray<FString>& Args)
+	{
+		const int32 Count = ParseCount(Args, 10000);
+
+		FCreditsDefaultAssets::Resolve();
+
+		double StartTime = FPlatformTime::Seconds();
+		{
+			TArray<FCreditsRole> Roles;
+			Roles.SetNum(Count);
+		}
+		const double SharedSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		{
+			TArray<Legacy::FRole> Roles;
+			Roles.Reserve(Count);
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				Roles.Emplace();
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.DefaultAssets: %d FCreditsRole, shared defaults %.3f ms, legacy constructors %.3f ms (%.1fx)"),
+			Count, SharedSeconds * 1000.0, LegacySeconds * 1000.0, SharedSeconds > 0.0 ? LegacySeconds / SharedSeconds : 0.0);
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.DefaultAssets: sizeof(FCreditsRole) %d bytes, legacy %d bytes, sizeof(FCreditsNameTextObject) %d bytes, legacy %d bytes"),
+			(int32)sizeof(FCreditsRole), (int32)sizeof(Legacy::FRole), (int32)sizeof(FCreditsNameTextObject), (int32)sizeof(Legacy::FNameTextObject));
+	}
+
+	static FAutoConsoleCommand DefaultAssetsCommand(
+		TEXT("Credits.Bench.DefaultAssets"),
+		TEXT("Times constructing N (default 10000) FCreditsRole with shared default assets against the legacy constructors, and compares their sizes."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&DefaultAssets));
+
+	/** Builds NumNames complex names spread over sections of 10 roles with 50 names each. */
+	static void MakeComplexSections(int32 NumNames, TArray<FCreditsSection>& OutSections)
+	{
+		const int32 NamesPerRole = 50;
+		const int32 RolesPerSection = 10;
+
+		OutSections.Reset();
+		int32 NameIndex = 0;
+		while (NameIndex < NumNames)
+		{
+			FCreditsSection& Section = OutSections.AddDefaulted_GetRef();
+			Section.SectionProperties.Title.TextProperties.Title = FString::Printf(TEXT("Section %d"), OutSections.Num());
+			Section.Roles.Reserve(RolesPerSection);
+			for (int32 RoleIndex = 0; RoleIndex < RolesPerSection && NameIndex < NumNames; ++RoleIndex)
+			{
+				FCreditsRole& Role = Section.Roles.AddDefaulted_GetRef();
+				Role.RoleProperties.Role.TextProperties.Title = FString::Printf(TEXT("Role %d"), RoleIndex);
+				Role.PlayedByNames.SetNum(FMath::Min(NamesPerRole, NumNames - NameIndex));
+				for (FCreditsNameTextObject& Name : Role.PlayedByNames)
+				{
+					Name.TextProperties.Title = FString::Printf(TEXT("Firstname Lastname %d"), NameIndex++);
+				}
+			}
+		}
+	}
+
+	/** Returns the heap and inline memory held by the nested credits tree. */
+	static SIZE_T GetComplexSectionsSize(const TArray<FCreditsSection>& Sections)
+	{
+		SIZE_T Size = Sections.GetAllocatedSize();
+		for (const FCreditsSection& Section : Sections)
+		{
+			Size += Section.Roles.GetAllocatedSize() + Section.SectionProperties.Title.TextProperties.Title.GetAllocatedSize();
+			for (const FCreditsRole& Role : Section.Roles)
+			{
+				Size += Role.PlayedByNames.GetAllocatedSize() + Role.RoleProperties.Role.TextProperties.Title.GetAllocatedSize();
+				for (const FCreditsNameTextObject& Name : Role.PlayedByNames)
+				{
+					Size += Name.TextProperties.Title.GetAllocatedSize();
+				}
+			}
+		}
+		return Size;
+	}
+
+	/** Compares memory per name and a full iteration of the nested tree against the compiled line table. */
+	static void LineTable(const TArray<FString>& Args)
+	{
+		for (const int32 NumNames : { 10000, 100000 })
+		{
+			TArray<FCreditsSection> Sections;
+			MakeComplexSections(NumNames, Sections);
+
+			FCreditsCompiledCredits Compiled;
+			double StartTime = FPlatformTime::Seconds();
+			FCreditsCompiler::Compile(Sections, Compiled);
+			const double CompileSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			const bool bMeasured = FCreditsLayout::Layout(Compiled);
+			const double LayoutSeconds = FPlatformTime::Seconds() - StartTime;
+
+			// walk the tree the way the widget stack does, reading the size and text of every name.
+			StartTime = FPlatformTime::Seconds();
+			int64 TreeChecksum = 0;
+			for (const FCreditsSection& Section : Sections)
+			{
+				for (const FCreditsRole& Role : Section.Roles)
+				{
+					for (const FCreditsNameTextObject& Name : Role.PlayedByNames)
+					{
+						TreeChecksum += Name.TextProperties.FontSize + Name.TextProperties.Title.Len();
+					}
+				}
+			}
+			const double TreeSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			const FCreditsLineTable& Lines = Compiled.Lines;
+			int64 TableChecksum = 0;
+			for (int32 Line = 0; Line < Lines.Num(); ++Line)
+			{
+				TableChecksum += (int64)Lines.Heights[Line] + Lines.TextLengths[Line];
+			}
+			const double TableSeconds = FPlatformTime::Seconds() - StartTime;
+
+			// one visible-range query per frame of a roll going through the whole credits.
+			const int32 NumQueries = 10000;
+			StartTime = FPlatformTime::Seconds();
+			int64 RangeChecksum = 0;
+			for (int32 Query = 0; Query < NumQueries; ++Query)
+			{
+				const float Top = Lines.TotalHeight * Query / NumQueries;
+				int32 First = 0;
+				int32 End = 0;
+				Lines.FindLineRange(Top, Top + 1080.0f, First, End);
+				RangeChecksum += End - First;
+			}
+			const double RangeSeconds = FPlatformTime::Seconds() - StartTime;
+
+			const double Names = NumNames;
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.LineTable: %d names, %d lines, %d unique styles, compile %.3f ms"), NumNames, Lines.Num(), Compiled.Styles.Num(), CompileSeconds * 1000.0);
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.LineTable: layout (%s) %.3f ms, total height %.0f, %d visible-range queries %.3f ms (%lld lines)"),
+				bMeasured ? TEXT("measured") : TEXT("estimated"), LayoutSeconds * 1000.0, Lines.TotalHeight, NumQueries, RangeSeconds * 1000.0, RangeChecksum);
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.LineTable: memory per name tree %.1f bytes, line table %.1f bytes"),
+				GetComplexSectionsSize(Sections) / Names, Compiled.GetAllocatedSize() / Names);
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.LineTable: iteration tree %.3f ms, line table %.3f ms (checksums %lld / %lld)"),
+				TreeSeconds * 1000.0, TableSeconds * 1000.0, TreeChecksum, TableChecksum);
+		}
+	}
+
+	static FAutoConsoleCommand LineTableCommand(
+		TEXT("Credits.Bench.LineTable"),
+		TEXT("Compares memory per name and iteration cost of the nested credits tree and the compiled line table at 10k and 100k names."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&LineTable));
+
+	/** Builds NumNames simple names spread over sections of 10 roles with 50 names each. */
+	static void MakeSimpleSections(int32 NumNames, TArray<FCreditsSectionSimple>& OutSections)
+	{
+		const int32 NamesPerRole = 50;
+		const int32 RolesPerSection = 10;
+
+		OutSections.Reset();
+		int32 NameIndex = 0;
+		while (NameIndex < NumNames)
+		{
+			FCreditsSectionSimple& Section = OutSections.AddDefaulted_GetRef();
+			Section.Title.Text = FString::Printf(TEXT("Section %d"), OutSections.Num());
+			Section.Roles.Reserve(RolesPerSection);
+			for (int32 RoleIndex = 0; RoleIndex < RolesPerSection && NameIndex < NumNames; ++RoleIndex)
+			{
+				FCreditsRoleStructSimple& Role = Section.Roles.AddDefaulted_GetRef();
+				Role.Role.Text = FString::Printf(TEXT("Role %d"), RoleIndex);
+				Role.DisplayRoleName = true;
+				Role.PlayedBy.SetNum(FMath::Min(NamesPerRole, NumNames - NameIndex));
+				for (FCreditsTextObjectSimple& Name : Role.PlayedBy)
+				{
+					Name.Text = FString::Printf(TEXT("Firstname Lastname %d"), NameIndex++);
+				}
+			}
+		}
+	}
+
+	/** Returns true when both conversions produced the same names in the same order. */
+	static bool HaveSameNames(const TArray<FCreditsSection>& A, const TArray<FCreditsSection>& B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+		for (int32 Section = 0; Section < A.Num(); ++Section)
+		{
+			if (A[Section].Roles.Num() != B[Section].Roles.Num())
+			{
+				return false;
+			}
+			for (int32 Role = 0; Role < A[Section].Roles.Num(); ++Role)
+			{
+				const TArray<FCreditsNameTextObject>& NamesA = A[Section].Roles[Role].PlayedByNames;
+				const TArray<FCreditsNameTextObject>& NamesB = B[Section].Roles[Role].PlayedByNames;
+				if (NamesA.Num() != NamesB.Num())
+				{
+					return false;
+				}
+				for (int32 Name = 0; Name < NamesA.Num(); ++Name)
+				{
+					if (NamesA[Name].TextProperties.Title != NamesB[Name].TextProperties.Title)
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	/** Times the simple to complex conversion of N (default 50000) names on worker threads against a single thread. */
+	static void Convert(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 50000);
+
+		TArray<FCreditsSectionSimple> Simple;
+		MakeSimpleSections(NumNames, Simple);
+
+		TArray<FCreditsSection> SingleThreaded;
+		double StartTime = FPlatformTime::Seconds();
+		FCreditsConverter::ConvertSections(Simple, nullptr, SingleThreaded, EParallelForFlags::ForceSingleThread);
+		const double SingleSeconds = FPlatformTime::Seconds() - StartTime;
+
+		TArray<FCreditsSection> Parallel;
+		StartTime = FPlatformTime::Seconds();
+		FCreditsConverter::ConvertSections(Simple, nullptr, Parallel);
+		const double ParallelSeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Convert: %d names in %d sections, single thread %.3f ms, parallel %.3f ms (%.1fx), identical output: %s"),
+			NumNames, Simple.Num(), SingleSeconds * 1000.0, ParallelSeconds * 1000.0, ParallelSeconds > 0.0 ? SingleSeconds / ParallelSeconds : 0.0,
+			HaveSameNames(SingleThreaded, Parallel) ? TEXT("yes") : TEXT("no"));
+	}
+
+	static FAutoConsoleCommand ConvertCommand(
+		TEXT("Credits.Bench.Convert"),
+		TEXT("Times converting N (default 50000) simple names to complex credits in parallel against a single thread."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Convert));
+
+	/** The by-value Make nodes the Blueprint library shipped with, every call copies its arguments once more. */
+	static FCreditsRole LegacyMakeCreditsRole(FCreditsRoleDefaults RoleProperties, TArray<FCreditsNameTextObject> PlayedByNames)
+	{
+		return FCreditsRole(RoleProperties, PlayedByNames);
+	}
+
+	static FCreditsSection LegacyMakeCreditsSection(FCreditsSectionDefaults SectionProperties, TArray<FCreditsRole> Roles)
+	{
+		return FCreditsSection(SectionProperties, Roles);
+	}
+
+	/**
+	 * Builds N (default 10000) names into sections of 10 roles with 50 names each, the way a Blueprint graph does
+	 * (names array, Make role, add to roles array, Make section) through the legacy by-value nodes, the const ref
+	 * nodes, and FCreditsBuilder.
+	 */
+	static void Builder(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 10000);
+		const int32 NamesPerRole = 50;
+		const int32 RolesPerSection = 10;
+		const int32 NamesPerSection = NamesPerRole * RolesPerSection;
+
+		const FCreditsSectionDefaults SectionProperties;
+		const FCreditsRoleDefaults RoleProperties;
+		const FCreditsNameTextObject NameTemplate;
+
+		TArray<FString> Texts;
+		Texts.Reserve(NumNames);
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			Texts.Add(FString::Printf(TEXT("Firstname Lastname %d"), Index));
+		}
+
+		// the Blueprint pattern, generic over the Make nodes used.
+		auto BuildLikeBlueprint = [&](auto MakeRole, auto MakeSection)
+		{
+			TArray<FCreditsSection> Sections;
+			for (int32 SectionStart = 0; SectionStart < NumNames; SectionStart += NamesPerSection)
+			{
+				TArray<FCreditsRole> Roles;
+				for (int32 RoleStart = SectionStart; RoleStart < FMath::Min(SectionStart + NamesPerSection, NumNames); RoleStart += NamesPerRole)
+				{
+					TArray<FCreditsNameTextObject> Names;
+					for (int32 Index = RoleStart; Index < FMath::Min(RoleStart + NamesPerRole, NumNames); ++Index)
+					{
+						FCreditsNameTextObject& Name = Names.Add_GetRef(NameTemplate);
+						Name.TextProperties.Title = Texts[Index];
+					}
+					Roles.Add(MakeRole(RoleProperties, Names));
+				}
+				Sections.Add(MakeSection(SectionProperties, Roles));
+			}
+			return Sections;
+		};
+
+		double StartTime = FPlatformTime::Seconds();
+		const int32 LegacySections = BuildLikeBlueprint(&LegacyMakeCreditsRole, &LegacyMakeCreditsSection).Num();
+		const double LegacySeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		const int32 ConstRefSections = BuildLikeBlueprint(&UCreditsBlueprintLibrary::MakeCreditsRole, &UCreditsBlueprintLibrary::MakeCreditsSection).Num();
+		const double ConstRefSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		FCreditsBuilder CreditsBuilder;
+		CreditsBuilder.Reserve(FMath::DivideAndRoundUp(NumNames, NamesPerSection));
+		for (int32 SectionStart = 0; SectionStart < NumNames; SectionStart += NamesPerSection)
+		{
+			const int32 SectionEnd = FMath::Min(SectionStart + NamesPerSection, NumNames);
+			CreditsBuilder.AddSection(SectionProperties, FMath::DivideAndRoundUp(SectionEnd - SectionStart, NamesPerRole));
+			for (int32 RoleStart = SectionStart; RoleStart < SectionEnd; RoleStart += NamesPerRole)
+			{
+				const int32 RoleEnd = FMath::Min(RoleStart + NamesPerRole, NumNames);
+				CreditsBuilder.AddRole(RoleProperties, RoleEnd - RoleStart);
+				for (int32 Index = RoleStart; Index < RoleEnd; ++Index)
+				{
+					CreditsBuilder.AddName(Texts[Index]);
+				}
+			}
+		}
+		const int32 BuilderSections = CreditsBuilder.Build().Num();
+		const double BuilderSeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Builder: %d names in %d/%d/%d sections, by-value nodes %.3f ms, const ref nodes %.3f ms, FCreditsBuilder %.3f ms (%.1fx)"),
+			NumNames, LegacySections, ConstRefSections, BuilderSections, LegacySeconds * 1000.0, ConstRefSeconds * 1000.0, BuilderSeconds * 1000.0,
+			BuilderSeconds > 0.0 ? LegacySeconds / BuilderSeconds : 0.0);
+	}
+
+	static FAutoConsoleCommand BuilderCommand(
+		TEXT("Credits.Bench.Builder"),
+		TEXT("Times building N (default 10000) names through the by-value Make nodes, the const ref Make nodes and FCreditsBuilder."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Builder));
+
+	/**
+	 * Loads N (default 100000) names both ways a shipped game would: a serialized DataTable of simple sections that is
+	 * loaded, converted and compiled, against the same credits saved as a binary file that is mapped, then copied
+	 * into compiled credits, timing and sizing the map and the copy apart.
+	 */
+	static void Binary(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 100000);
+
+		TArray<FCreditsSectionSimple> Simple;
+		MakeSimpleSections(NumNames, Simple);
+
+		UDataTable* SourceTable = NewObject<UDataTable>(GetTransientPackage());
+		SourceTable->RowStruct = FCreditsSectionSimple::StaticStruct();
+		for (int32 Index = 0; Index < Simple.Num(); ++Index)
+		{
+			SourceTable->AddRow(*FString::Printf(TEXT("Section%d"), Index), Simple[Index]);
+		}
+
+		// the table bytes stand in for the cooked asset, loading it is deserializing them.
+		TArray<uint8> TableBytes;
+		FObjectWriter TableWriter(SourceTable, TableBytes);
+
+		double StartTime = FPlatformTime::Seconds();
+		UDataTable* LoadedTable = NewObject<UDataTable>(GetTransientPackage());
+		LoadedTable->RowStruct = FCreditsSectionSimple::StaticStruct();
+		FObjectReader TableReader(LoadedTable, TableBytes);
+		TArray<FCreditsSection> Sections;
+		FCreditsConverter::ConvertDataTable(LoadedTable, nullptr, Sections);
+		FCreditsCompiledCredits FromTable;
+		FCreditsCompiler::Compile(Sections, FromTable);
+		FCreditsLayout::Layout(FromTable);
+		const double TableSeconds = FPlatformTime::Seconds() - StartTime;
+		const SIZE_T TableBytesResident = LoadedTable->GetResourceSizeBytes(EResourceSizeMode::Exclusive) + Sections.GetAllocatedSize() + FromTable.GetAllocatedSize();
+
+		const FString Filename = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("CreditsBench"), TEXT(".credits"));
+		if (!FCreditsBinary::Save(FromTable, Filename))
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("Credits.Bench.Binary: could not write %s"), *Filename);
+			return;
+		}
+
+		int32 MappedLines = 0;
+		int64 MappedBytes = 0;
+		double MapSeconds = 0.0;
+		double CopySeconds = 0.0;
+		SIZE_T CopiedBytes = 0;
+		{
+			StartTime = FPlatformTime::Seconds();
+			FCreditsMappedCredits Mapped;
+			Mapped.Open(Filename);
+			MapSeconds = FPlatformTime::Seconds() - StartTime;
+			MappedLines = Mapped.Num();
+			MappedBytes = Mapped.GetMappedSize();
+
+			// the table path found its fonts already loaded, so the copy is timed with them loaded too.
+			const TSharedPtr<FStreamableHandle> AssetsHandle = Mapped.RequestAssets();
+			if (AssetsHandle.IsValid())
+			{
+				AssetsHandle->WaitUntilComplete();
+			}
+
+			StartTime = FPlatformTime::Seconds();
+			FCreditsCompiledCredits FromBinary;
+			Mapped.ToCompiledCredits(FromBinary);
+			CopySeconds = FPlatformTime::Seconds() - StartTime;
+			CopiedBytes = FromBinary.GetAllocatedSize();
+		}
+		const double BinarySeconds = MapSeconds + CopySeconds;
+		IFileManager::Get().Delete(*Filename);
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Binary: %d names, %d lines, DataTable load+convert+compile %.3f ms, binary map %.3f ms, copy to compiled credits %.3f ms, map+copy %.3f ms (%.1fx)"),
+			NumNames, MappedLines, TableSeconds * 1000.0, MapSeconds * 1000.0, CopySeconds * 1000.0, BinarySeconds * 1000.0, BinarySeconds > 0.0 ? TableSeconds / BinarySeconds : 0.0);
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Binary: resident DataTable path %.1f KB, mapped file %.1f KB, copied compiled credits %.1f KB, binary path %.1f KB"),
+			TableBytesResident / 1024.0, MappedBytes / 1024.0, CopiedBytes / 1024.0, (MappedBytes + CopiedBytes) / 1024.0);
+	}
+
+	static FAutoConsoleCommand BinaryCommand(
+		TEXT("Credits.Bench.Binary"),
+		TEXT("Times loading N (default 100000) names from a serialized DataTable against mapping and copying out the same credits saved as a binary file."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Binary));
+
+	/** Writes a flat Section,Role,Name CSV export of NumNames names, renaming a name in every EditEvery-th section when EditEvery > 0. */
+	static FString MakeCreditsCsv(int32 NumNames, int32 EditEvery)
+	{
+		const int32 NamesPerRole = 50;
+		const int32 RolesPerSection = 10;
+
+		FString Csv = TEXT("Section,Role,Name\n");
+		Csv.Reserve(NumNames * 48);
+		for (int32 NameIndex = 0; NameIndex < NumNames; ++NameIndex)
+		{
+			const int32 RoleIndex = NameIndex / NamesPerRole;
+			const int32 SectionIndex = RoleIndex / RolesPerSection;
+			const bool bEdited = EditEvery > 0 && SectionIndex % EditEvery == 0 && NameIndex % (NamesPerRole * RolesPerSection) == 0;
+			Csv += FString::Printf(TEXT("Section %d,Role %d,\"Lastname, Firstname %d%s\"\n"), SectionIndex + 1, RoleIndex % RolesPerSection, NameIndex, bEdited ? TEXT(" Jr.") : TEXT(""));
+		}
+		return Csv;
+	}
+
+	/**
+	 * Imports N names (default 10000, 50000 and 100000) into a sections table three times: into an empty table, the
+	 * same export again, and the export with a name edited in 1% of the sections, logging each import's timings.
+	 */
+	static void Import(const TArray<FString>& Args)
+	{
+		TArray<int32> Counts = { 10000, 50000, 100000 };
+		if (Args.Num() > 0)
+		{
+			Counts = { ParseCount(Args, 10000) };
+		}
+
+		for (const int32 NumNames : Counts)
+		{
+			const FString Csv = MakeCreditsCsv(NumNames, 0);
+			const FString EditedCsv = MakeCreditsCsv(NumNames, 100);
+
+			UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+			Table->RowStruct = FCreditsSectionSimple::StaticStruct();
+
+			FCreditsImportStats Full;
+			FCreditsImportStats Same;
+			FCreditsImportStats Edited;
+			double StartTime = FPlatformTime::Seconds();
+			FCreditsImporter::ImportSections(Table, Csv, ECreditsImportFormat::Csv, true, &Full);
+			const double FullSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			FCreditsImporter::ImportSections(Table, Csv, ECreditsImportFormat::Csv, true, &Same);
+			const double SameSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			FCreditsImporter::ImportSections(Table, EditedCsv, ECreditsImportFormat::Csv, true, &Edited);
+			const double EditedSeconds = FPlatformTime::Seconds() - StartTime;
+
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Import: %d rows, full import %.3f ms (%d added), unchanged reimport %.3f ms (%d written), 1%% sections edited reimport %.3f ms (%d of %d rows written)"),
+				NumNames, FullSeconds * 1000.0, Full.NumAdded, SameSeconds * 1000.0, Same.NumAdded + Same.NumChanged, EditedSeconds * 1000.0, Edited.NumAdded + Edited.NumChanged, Edited.NumRows);
+		}
+	}
+
+	static FAutoConsoleCommand ImportCommand(
+		TEXT("Credits.Bench.Import"),
+		TEXT("Times importing N (default 10000, 50000 and 100000) names from CSV into a sections table, then reimporting it unchanged and with 1% of the sections edited."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Import));
+
+	/**
+	 * Follows a DataTable of N (default 100000) names with an incremental compiler, then edits one name in the middle
+	 * section and times the update that recompiles it, against compiling the whole table again.
+	 */
+	static void Incremental(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 100000);
+
+		TArray<FCreditsSectionSimple> Simple;
+		MakeSimpleSections(NumNames, Simple);
+
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage());
+		Table->RowStruct = FCreditsSectionSimple::StaticStruct();
+		for (int32 Index = 0; Index < Simple.Num(); ++Index)
+		{
+			Table->AddRow(*FString::Printf(TEXT("Section%d"), Index), Simple[Index]);
+		}
+
+		TSharedRef<FCreditsIncrementalCompiler> Compiler = MakeShared<FCreditsIncrementalCompiler>(Table, nullptr, nullptr, nullptr);
+		double StartTime = FPlatformTime::Seconds();
+		Compiler->Start();
+		const double FullSeconds = FPlatformTime::Seconds() - StartTime;
+
+		int32 FirstLine = INDEX_NONE;
+		int32 NumFullRecompiles = 0;
+		Compiler->OnRecompiled.AddLambda([&FirstLine, &NumFullRecompiles](int32 InFirstLine, bool bFullRecompile, const TArray<int32>& ImageRemap)
+		{
+			FirstLine = InFirstLine;
+			NumFullRecompiles += bFullRecompile ? 1 : 0;
+		});
+
+		const FName RowName = *FString::Printf(TEXT("Section%d"), Simple.Num() / 2);
+		FCreditsSectionSimple* Row = Table->FindRow<FCreditsSectionSimple>(RowName, TEXT("Credits.Bench.Incremental"));
+		if (Row == nullptr || Row->Roles.Num() == 0 || Row->Roles[0].PlayedBy.Num() == 0)
+		{
+			return;
+		}
+		Row->Roles[0].PlayedBy[0].Text += TEXT(" Jr.");
+
+		// the change notification runs the update, as it would after an edit in the DataTable editor.
+		StartTime = FPlatformTime::Seconds();
+		Table->HandleDataTableChanged(RowName);
+		const double UpdateSeconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Incremental: %d names, %d lines, full compile %.3f ms, one name edited update %.3f ms (%.1fx), first changed line %d, full recompiles %d"),
+			NumNames, Compiler->GetCompiledCredits()->Lines.Num(), FullSeconds * 1000.0, UpdateSeconds * 1000.0, UpdateSeconds > 0.0 ? FullSeconds / UpdateSeconds : 0.0, FirstLine, NumFullRecompiles);
+	}
+
+	static FAutoConsoleCommand IncrementalCommand(
+		TEXT("Credits.Bench.Incremental"),
+		TEXT("Times recompiling the credits after one name of a DataTable of N (default 100000) names is edited, against compiling them whole."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Incremental));
+
+	/**
+	 * Evaluates a speed curve of a few keys N (default 1000000) times as a rich curve and as a baked table, then
+	 * scrolls 120 seconds of it summing up frames at 30 and 144 fps against the baked integral.
+	 */
+	static void Curves(const TArray<FString>& Args)
+	{
+		const int32 NumEvaluations = ParseCount(Args, 1000000);
+
+		UCurveFloat* Curve = NewObject<UCurveFloat>(GetTransientPackage());
+		Curve->FloatCurve.AddKey(0.0f, 0.0f);
+		Curve->FloatCurve.AddKey(3.0f, 80.0f);
+		Curve->FloatCurve.AddKey(60.0f, 60.0f);
+		Curve->FloatCurve.AddKey(110.0f, 120.0f);
+		Curve->FloatCurve.AddKey(120.0f, 40.0f);
+		for (FRichCurveKey& Key : Curve->FloatCurve.Keys)
+		{
+			Key.InterpMode = RCIM_Cubic;
+		}
+		Curve->FloatCurve.AutoSetTangents();
+
+		double StartTime = FPlatformTime::Seconds();
+		FCreditsCurveTable Table;
+		Table.Bake(Curve, 0.0f);
+		const double BakeSeconds = FPlatformTime::Seconds() - StartTime;
+
+		const float Duration = 120.0f;
+		double CurveSum = 0.0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumEvaluations; ++Index)
+		{
+			CurveSum += Curve->GetFloatValue(Index * Duration / NumEvaluations);
+		}
+		const double CurveSeconds = FPlatformTime::Seconds() - StartTime;
+
+		double TableSum = 0.0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumEvaluations; ++Index)
+		{
+			TableSum += Table.Evaluate(Index * Duration / NumEvaluations);
+		}
+		const double TableSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// how a per-frame driver used to scroll, the speed of each frame times its length.
+		auto SumFrames = [Curve, Duration](float FrameRate)
+		{
+			const float DeltaTime = 1.0f / FrameRate;
+			float Time = 0.0f;
+			float Offset = 0.0f;
+			while (Time < Duration)
+			{
+				Offset += Curve->GetFloatValue(Time) * DeltaTime;
+				Time += DeltaTime;
+			}
+			return Offset;
+		};
+		const float Integral = Table.EvaluateIntegral(Duration);
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Curves: bake %.3f ms (%.1f KB), %d evaluations rich curve %.3f ms, baked table %.3f ms (%.1fx), mean difference %.4f"),
+			BakeSeconds * 1000.0, Table.GetAllocatedSize() / 1024.0, NumEvaluations, CurveSeconds * 1000.0, TableSeconds * 1000.0, TableSeconds > 0.0 ? CurveSeconds / TableSeconds : 0.0, FMath::Abs(CurveSum - TableSum) / NumEvaluations);
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Curves: scrolled after %.0f s, summed frames at 30 fps %.2f, at 144 fps %.2f, baked integral %.2f"),
+			Duration, SumFrames(30.0f), SumFrames(144.0f), Integral);
+	}
+
+	static FAutoConsoleCommand CurvesCommand(
+		TEXT("Credits.Bench.Curves"),
+		TEXT("Times evaluating a speed curve N (default 1000000) times as a rich curve and as a baked table, and compares summed frames against the baked integral."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Curves));
+
+	/**
+	 * Compiles N (default 100000) names and seeks to the first, middle and last section the way a roll does: finding
+	 * the section, the roll time at which it is reached and the lines around it, logging the cost of each seek.
+	 */
+	static void Seek(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 100000);
+		const int32 NumSeeks = 10000;
+
+		TArray<FCreditsSectionSimple> Simple;
+		MakeSimpleSections(NumNames, Simple);
+		TArray<FCreditsSection> Sections;
+		FCreditsConverter::ConvertSections(Simple, nullptr, Sections);
+		FCreditsCompiledCredits Compiled;
+		FCreditsCompiler::Compile(Sections, Compiled);
+		FCreditsLayout::Layout(Compiled);
+		const FCreditsLineTable& Lines = Compiled.Lines;
+
+		// a constant speed that rolls the whole credits in 20 minutes.
+		FCreditsCurveTable Speed;
+		Speed.Bake(nullptr, Lines.TotalHeight / (20.0f * 60.0f));
+
+		const int32 NumSections = Lines.SectionNames.Num();
+		const int32 Targets[] = { 0, NumSections / 2, NumSections - 1 };
+		for (const int32 Target : Targets)
+		{
+			const FName SectionName = Lines.SectionNames[Target];
+			float Time = 0.0f;
+			int64 NumLines = 0;
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Seek = 0; Seek < NumSeeks; ++Seek)
+			{
+				const int32 SectionIndex = Lines.FindSection(SectionName);
+				const float Offset = Lines.SectionOffsetsY[SectionIndex];
+				Time = Speed.FindTimeAtIntegral(Offset);
+
+				int32 FirstLine;
+				int32 EndLine;
+				Lines.FindLineRange(Offset, Offset + 1080.0f, FirstLine, EndLine);
+				NumLines += EndLine - FirstLine;
+			}
+			const double SeekSeconds = FPlatformTime::Seconds() - StartTime;
+
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Seek: %d lines in %d sections, seek to %s at %.1f s, %.3f us per seek, %lld lines shown"),
+				Lines.Num(), NumSections, *SectionName.ToString(), Time, SeekSeconds * 1000000.0 / NumSeeks, NumLines / NumSeeks);
+		}
+	}
+
+	static FAutoConsoleCommand SeekCommand(
+		TEXT("Credits.Bench.Seek"),
+		TEXT("Times seeking to the first, middle and last section of N (default 100000) names rolling for 20 minutes."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Seek));
+
+	/**
+	 * Runs the data-scale benchmark over N (default 100000) synthetic names, with the override density and image ratio
+	 * given as the next arguments, the CreditsBenchmark commandlet running it at every scale against a baseline.
+	 */
+	static void Scale(const TArray<FString>& Args)
+	{
+		FCreditsSyntheticSettings Settings;
+		Settings.NumNames = ParseCount(Args, 100000);
+		Settings.OverrideDensity = Args.Num() > 1 ? FCString::Atof(*Args[1]) : Settings.OverrideDensity;
+		Settings.ImageRatio = Args.Num() > 2 ? FCString::Atof(*Args[2]) : Settings.ImageRatio;
+
+		const FCreditsScaleResult Result = UCreditsBenchmarkCommandlet::RunScale(Settings);
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Scale: %d names, %d lines, %d styles, convert %.3f ms, compile %.3f ms, layout (%s) %.3f ms, peak memory %.1f MB, compiled %.1f KB, binary %.1f KB"),
+			Result.NumNames, Result.NumLines, Result.NumStyles, Result.ConvertMs, Result.CompileMs, Result.bMeasured ? TEXT("measured") : TEXT("estimated"), Result.LayoutMs,
+			Result.PeakMemoryMB, Result.CompiledKB, Result.BinaryKB);
+	}
+
+	static FAutoConsoleCommand ScaleCommand(
+		TEXT("Credits.Bench.Scale"),
+		TEXT("Times the credits pipeline over N (default 100000) synthetic names, then an override density and an image ratio."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Scale));
+
+	/**
+	 * Compiles N (default 100000) names up front, then rolls them through a lazy compiler a quarter of a 1080 high
+	 * viewport at a time, comparing the up-front time and the lines held against the worst update of the roll.
+	 */
+	static void Lazy(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 100000);
+		const float ViewportHeight = 1080.0f;
+		const float Margin = 200.0f;
+		const float Lookahead = 1000.0f;
+
+		TArray<FCreditsSectionSimple> Simple;
+		MakeSimpleSections(NumNames, Simple);
+
+		double StartTime = FPlatformTime::Seconds();
+		TArray<FCreditsSection> Converted;
+		FCreditsConverter::ConvertSections(Simple, nullptr, Converted);
+		FCreditsCompiledCredits Eager;
+		FCreditsCompiler::Compile(Converted, Eager);
+		FCreditsLayout::Layout(Eager);
+		const double EagerSeconds = FPlatformTime::Seconds() - StartTime;
+		const SIZE_T EagerBytes = GetComplexSectionsSize(Converted) + Eager.GetAllocatedSize();
+		Converted.Empty();
+
+		StartTime = FPlatformTime::Seconds();
+		// keyed by title, as the eager conversion of an array of sections above is.
+		TArray<FName> SectionKeys;
+		SectionKeys.Reserve(Simple.Num());
+		for (const FCreditsSectionSimple& Section : Simple)
+		{
+			SectionKeys.Add(FName(*Section.Title.Text));
+		}
+		FCreditsLazyCompiler Compiler(Simple, SectionKeys, nullptr, nullptr, nullptr);
+		Compiler.Start();
+		const double StartSeconds = FPlatformTime::Seconds() - StartTime;
+		const FCreditsLineTable& Lines = Compiler.GetCompiledCredits()->Lines;
+		const float EstimatedHeight = Lines.TotalHeight;
+
+		int32 NumUpdates = 0;
+		int32 MaxLines = 0;
+		int32 MaxMaterialized = 0;
+		double MaxUpdateSeconds = 0.0;
+		double TotalUpdateSeconds = 0.0;
+		for (float Offset = 0.0f; Offset < Lines.TotalHeight; Offset += ViewportHeight * 0.25f)
+		{
+			StartTime = FPlatformTime::Seconds();
+			Compiler.Update(Offset, Offset - Margin, Offset + ViewportHeight + Margin + Lookahead);
+			const double UpdateSeconds = FPlatformTime::Seconds() - StartTime;
+			MaxUpdateSeconds = FMath::Max(MaxUpdateSeconds, UpdateSeconds);
+			TotalUpdateSeconds += UpdateSeconds;
+			MaxLines = FMath::Max(MaxLines, Lines.Num());
+			MaxMaterialized = FMath::Max(MaxMaterialized, Compiler.GetNumMaterialized());
+			++NumUpdates;
+		}
+
+		UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.Lazy: %d names, %d sections, eager compile %.3f ms for %d lines (%.1f KB), lazy start %.3f ms, %d updates, worst %.3f ms, total %.3f ms, at most %d lines in %d sections, height estimated %.0f, exact %.0f"),
+			NumNames, Simple.Num(), EagerSeconds * 1000.0, Eager.Lines.Num(), EagerBytes / 1024.0, StartSeconds * 1000.0, NumUpdates, MaxUpdateSeconds * 1000.0, TotalUpdateSeconds * 1000.0,
+			MaxLines, MaxMaterialized, EstimatedHeight, Eager.Lines.TotalHeight);
+	}
+
+	static FAutoConsoleCommand LazyCommand(
+		TEXT("Credits.Bench.Lazy"),
+		TEXT("Compares compiling N (default 100000) names up front with compiling their sections lazily as a viewport rolls over them."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Lazy));
+
+	/** Returns the seconds taken to resolve the defaults of every name of Synthetic, with the resolver or per name. */
+	static double TimeStyleResolve(const FCreditsSyntheticCredits& Synthetic, const FCreditsOverrideIndex& Overrides, bool bMemoized, int32& OutNumOverridden)
+	{
+		FCreditsStyleResolver Resolver(&Overrides);
+		OutNumOverridden = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (const FCreditsSectionSimple& Section : Synthetic.Sections)
+		{
+			const FName SectionKey(*Section.Title.Text);
+			for (const FCreditsRoleStructSimple& Role : Section.Roles)
+			{
+				const FName RoleKey(*Role.Role.Text);
+				if (bMemoized)
+				{
+					const FCreditsStyleScope& Scope = Resolver.GetScope(Resolver.ResolveScope(SectionKey, RoleKey));
+					for (const FCreditsTextObjectSimple& Name : Role.PlayedBy)
+					{
+						OutNumOverridden += &Resolver.ResolveName(Scope, Name.Text) != Scope.Name ? 1 : 0;
+					}
+				}
+				else
+				{
+					for (const FCreditsTextObjectSimple& Name : Role.PlayedBy)
+					{
+						const FCreditsNameTextObject* Override = Overrides.FindNameOverride(SectionKey, RoleKey, FName(*Name.Text));
+						OutNumOverridden += Override ? 1 : 0;
+					}
+				}
+			}
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	/**
+	 * Resolves the defaults of N (default 100000) synthetic names, and of a tenth of them, looking every name up
+	 * against resolving each (section, role) scope once, to check that both stay linear in the names.
+	 */
+	static void StyleResolve(const TArray<FString>& Args)
+	{
+		const int32 NumNames = ParseCount(Args, 100000);
+
+		for (const int32 Count : { FMath::Max(1, NumNames / 10), NumNames })
+		{
+			FCreditsSyntheticSettings Settings;
+			Settings.NumNames = Count;
+			FCreditsSyntheticCredits Synthetic;
+			Synthetic.Generate(Settings);
+
+			FCreditsOverrideIndex Overrides;
+			Overrides.Build(Synthetic.RoleOverrides, Synthetic.NameOverrides);
+
+			int32 NumLookedUp = 0;
+			int32 NumResolved = 0;
+			const double LookupSeconds = TimeStyleResolve(Synthetic, Overrides, false, NumLookedUp);
+			const double ResolveSeconds = TimeStyleResolve(Synthetic, Overrides, true, NumResolved);
+
+			UE_LOG(ClosingCreditsLog, Display, TEXT("Credits.Bench.StyleResolve: %d names, %d name overrides, per name lookup %.3f ms (%.1f ns/name), memoized scopes %.3f ms (%.1f ns/name), %s overridden names"),
+				Count, Synthetic.NameOverrides.Num(), LookupSeconds * 1000.0, LookupSeconds * 1e9 / Count, ResolveSeconds * 1000.0, ResolveSeconds * 1e9 / Count,
+				NumLookedUp == NumResolved ? TEXT("same") : TEXT("DIFFERENT"));
+		}
+	}
+
+	static FAutoConsoleCommand StyleResolveCommand(
+		TEXT("Credits.Bench.StyleResolve"),
+		TEXT("Compares looking up the overrides of every name with resolving them once per (section, role) scope over N (default 100000) synthetic names."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&StyleResolve));
+}
+
+#endif // !UE_BUILD_SHIPPING
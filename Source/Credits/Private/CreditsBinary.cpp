@@ -0,0 +1,458 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsBinary.h"
+#include "Async/MappedFileHandle.h"
+#include "Engine/Font.h"
+#include "Engine/Texture2D.h"
+#include "HAL/PlatformFileManager.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/FileHelper.h"
+#include "CreditsAssetStreamer.h"
+#include "CreditsCompiler.h"
+#include "CreditsModule.h"
+
+/** 'CRDT', read back swapped on a platform of the other endianness. */
+static const uint32 CreditsBinaryMagic = 0x54445243;
+
+/** Bumped whenever the layout of the header, a chunk or a stored struct changes. */
+static const uint32 CreditsBinaryVersion = 1;
+
+/** Alignment of every chunk, enough for any stored type. */
+static const int32 CreditsBinaryAlignment = 16;
+
+static_assert(sizeof(TCHAR) == 2, "FCreditsBinary stores text as UTF-16");
+
+namespace CreditsBinary
+{
+	/** Appends Num items as chunk Chunk, aligned, recording where it went in Header. */
+	template<typename ItemType>
+	static void WriteChunk(TArray<uint8>& Data, FCreditsBinaryHeader& Header, ECreditsBinaryChunk::Type Chunk, const ItemType* Items, int32 Num)
+	{
+		const int32 Offset = Align(Data.Num(), CreditsBinaryAlignment);
+		const int32 Size = Num * (int32)sizeof(ItemType);
+		Data.SetNumZeroed(Offset);
+		Data.Append(reinterpret_cast<const uint8*>(Items), Size);
+
+		Header.ChunkOffsets[Chunk] = Offset;
+		Header.ChunkSizes[Chunk] = Size;
+	}
+
+	template<typename ItemType>
+	static void WriteChunk(TArray<uint8>& Data, FCreditsBinaryHeader& Header, ECreditsBinaryChunk::Type Chunk, const TArray<ItemType>& Items)
+	{
+		WriteChunk(Data, Header, Chunk, Items.GetData(), Items.Num());
+	}
+
+	/** Points View at chunk Chunk of Data, which must hold exactly Num items. */
+	template<typename ItemType>
+	static bool MapChunk(const uint8* Data, int64 Size, const FCreditsBinaryHeader& Header, ECreditsBinaryChunk::Type Chunk, int32 Num, TConstArrayView<ItemType>& View)
+	{
+		const uint64 Offset = Header.ChunkOffsets[Chunk];
+		const uint64 ChunkSize = Header.ChunkSizes[Chunk];
+		if (Num < 0 || ChunkSize != (uint64)Num * sizeof(ItemType) || Offset % alignof(ItemType) != 0 || Offset > (uint64)Size || ChunkSize > (uint64)Size - Offset)
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsMappedCredits: chunk %d is out of bounds"), (int32)Chunk);
+			return false;
+		}
+		View = TConstArrayView<ItemType>(reinterpret_cast<const ItemType*>(Data + Offset), Num);
+		return true;
+	}
+
+	/** Simple struct for the asset paths referenced by a binary file, each stored once. */
+	struct FAssetTable
+	{
+		TArray<int32> Starts;
+		TArray<int32> Lengths;
+		TArray<TCHAR> Pool;
+		TMap<FSoftObjectPath, int32> Lookup;
+
+		/** Returns the index of Path, adding it when new, INDEX_NONE for a null path. */
+		int32 Add(const FSoftObjectPath& Path)
+		{
+			if (Path.IsNull())
+			{
+				return INDEX_NONE;
+			}
+			if (const int32* Found = Lookup.Find(Path))
+			{
+				return *Found;
+			}
+
+			const FString PathString = Path.ToString();
+			Starts.Add(Pool.Num());
+			Lengths.Add(PathString.Len());
+			Pool.Append(*PathString, PathString.Len());
+			return Lookup.Add(Path, Starts.Num() - 1);
+		}
+	};
+}
+
+void FCreditsBinary::Write(const FCreditsCompiledCredits& Credits, TArray<uint8>& OutData)
+{
+	const FCreditsLineTable& Lines = Credits.Lines;
+	CreditsBinary::FAssetTable Assets;
+
+	TArray<FCreditsBinaryStyle> Styles;
+	Styles.SetNumZeroed(Credits.Styles.Num());
+	for (int32 StyleIndex = 0; StyleIndex < Credits.Styles.Num(); ++StyleIndex)
+	{
+		const FCreditsLineStyle& Style = Credits.Styles[StyleIndex];
+		FCreditsBinaryStyle& Stored = Styles[StyleIndex];
+		Stored.FontAsset = Assets.Add(FSoftObjectPath(Style.Font));
+		Stored.FontMaterialAsset = Assets.Add(FSoftObjectPath(Style.FontMaterial));
+		Stored.FontSize = Style.FontSize;
+		Stored.Color = Style.Color;
+		Stored.Padding[0] = Style.Padding.Left;
+		Stored.Padding[1] = Style.Padding.Top;
+		Stored.Padding[2] = Style.Padding.Right;
+		Stored.Padding[3] = Style.Padding.Bottom;
+		Stored.ImageSizeOverride = Style.ImageSizeOverride;
+		Stored.ImageSize[0] = Style.ImageSizeProperties.X;
+		Stored.ImageSize[1] = Style.ImageSizeProperties.Y;
+	}
+
+	TArray<FCreditsBinaryImage> Images;
+	Images.SetNumZeroed(Credits.ImagePaths.Num());
+	for (int32 ImageIndex = 0; ImageIndex < Credits.ImagePaths.Num(); ++ImageIndex)
+	{
+		FCreditsBinaryImage& Stored = Images[ImageIndex];
+		Stored.Asset = Assets.Add(Credits.ImagePaths[ImageIndex]);
+		Stored.NativeSize[0] = Credits.ImageBrushes[ImageIndex].ImageSize.X;
+		Stored.NativeSize[1] = Credits.ImageBrushes[ImageIndex].ImageSize.Y;
+		Stored.bSoft = Credits.SoftImages[ImageIndex];
+	}
+
+	FCreditsBinaryHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = CreditsBinaryMagic;
+	Header.Version = CreditsBinaryVersion;
+	Header.NumLines = Lines.Num();
+	Header.NumSections = Lines.SectionStarts.Num();
+	Header.NumStyles = Styles.Num();
+	Header.NumImages = Images.Num();
+	Header.NumAssets = Assets.Starts.Num();
+	Header.NumChars = Lines.StringPool.Len();
+	Header.NumAssetChars = Assets.Pool.Num();
+	Header.TotalHeight = Lines.TotalHeight;
+	Header.bMeasured = Lines.bMeasured;
+
+	OutData.Reset();
+	OutData.SetNumZeroed(sizeof(FCreditsBinaryHeader));
+
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::StringPool, *Lines.StringPool, Lines.StringPool.Len());
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::TextStarts, Lines.TextStarts);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::TextLengths, Lines.TextLengths);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::StyleIndices, Lines.StyleIndices);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::ImageIndices, Lines.ImageIndices);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::OffsetsY, Lines.OffsetsY);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Widths, Lines.Widths);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Heights, Lines.Heights);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Kinds, Lines.Kinds);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Flags, Lines.Flags);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::SectionStarts, Lines.SectionStarts);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::SectionPaddingTop, Lines.SectionPaddingTop);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::SectionPaddingBottom, Lines.SectionPaddingBottom);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Styles, Styles);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::Images, Images);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::AssetStarts, Assets.Starts);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::AssetLengths, Assets.Lengths);
+	CreditsBinary::WriteChunk(OutData, Header, ECreditsBinaryChunk::AssetPool, Assets.Pool);
+
+	FMemory::Memcpy(OutData.GetData(), &Header, sizeof(FCreditsBinaryHeader));
+}
+
+bool FCreditsBinary::Save(const FCreditsCompiledCredits& Credits, const FString& Filename)
+{
+	TArray<uint8> Data;
+	Write(Credits, Data);
+	return FFileHelper::SaveArrayToFile(Data, *Filename);
+}
+
+FCreditsMappedCredits::FCreditsMappedCredits()
+	: MappedFile(nullptr)
+	, MappedRegion(nullptr)
+	, Header(nullptr)
+{
+}
+
+FCreditsMappedCredits::~FCreditsMappedCredits()
+{
+	Close();
+}
+
+bool FCreditsMappedCredits::Open(const FString& Filename)
+{
+	Close();
+
+	MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename);
+	if (MappedFile)
+	{
+		MappedRegion = MappedFile->MapRegion(0, MappedFile->GetFileSize());
+	}
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		delete MappedFile;
+		MappedFile = nullptr;
+		if (!FFileHelper::LoadFileToArray(FallbackData, *Filename))
+		{
+			return false;
+		}
+		Data = FallbackData.GetData();
+		Size = FallbackData.Num();
+	}
+
+	if (!MapViews(Data, Size))
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsMappedCredits: %s is not a valid credits binary file"), *Filename);
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void FCreditsMappedCredits::Close()
+{
+	Header = nullptr;
+	TextStarts = TextLengths = AssetStarts = AssetLengths = TConstArrayView<int32>();
+	StringPool = AssetPool = TConstArrayView<TCHAR>();
+	StyleIndices = TConstArrayView<uint16>();
+	ImageIndices = SectionStarts = TConstArrayView<int32>();
+	OffsetsY = Widths = Heights = SectionPaddingTop = SectionPaddingBottom = TConstArrayView<float>();
+	Kinds = TConstArrayView<ECreditsLineKind>();
+	Flags = TConstArrayView<uint8>();
+	Styles = TConstArrayView<FCreditsBinaryStyle>();
+	Images = TConstArrayView<FCreditsBinaryImage>();
+
+	// the region goes before the file it maps.
+	delete MappedRegion;
+	MappedRegion = nullptr;
+	delete MappedFile;
+	MappedFile = nullptr;
+	FallbackData.Empty();
+}
+
+bool FCreditsMappedCredits::MapViews(const uint8* Data, int64 Size)
+{
+	if (Size < (int64)sizeof(FCreditsBinaryHeader))
+	{
+		return false;
+	}
+
+	const FCreditsBinaryHeader& FileHeader = *reinterpret_cast<const FCreditsBinaryHeader*>(Data);
+	if (FileHeader.Magic != CreditsBinaryMagic || FileHeader.Version != CreditsBinaryVersion)
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsMappedCredits: unsupported magic %08x or version %u"), FileHeader.Magic, FileHeader.Version);
+		return false;
+	}
+
+	const int32 NumLines = FileHeader.NumLines;
+	const int32 NumSections = FileHeader.NumSections;
+	const bool bChunksValid = CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::StringPool, FileHeader.NumChars, StringPool)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::TextStarts, NumLines, TextStarts)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::TextLengths, NumLines, TextLengths)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::StyleIndices, NumLines, StyleIndices)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::ImageIndices, NumLines, ImageIndices)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::OffsetsY, NumLines, OffsetsY)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Widths, NumLines, Widths)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Heights, NumLines, Heights)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Kinds, NumLines, Kinds)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Flags, NumLines, Flags)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::SectionStarts, NumSections, SectionStarts)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::SectionPaddingTop, NumSections, SectionPaddingTop)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::SectionPaddingBottom, NumSections, SectionPaddingBottom)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Styles, FileHeader.NumStyles, Styles)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::Images, FileHeader.NumImages, Images)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::AssetStarts, FileHeader.NumAssets, AssetStarts)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::AssetLengths, FileHeader.NumAssets, AssetLengths)
+		&& CreditsBinary::MapChunk(Data, Size, FileHeader, ECreditsBinaryChunk::AssetPool, FileHeader.NumAssetChars, AssetPool);
+	if (!bChunksValid)
+	{
+		return false;
+	}
+
+	// every view handed out later is trusted, so each reference is checked once here.
+	for (int32 Line = 0; Line < NumLines; ++Line)
+	{
+		if (TextStarts[Line] < 0 || TextLengths[Line] < 0 || TextStarts[Line] > StringPool.Num() - TextLengths[Line]
+			|| StyleIndices[Line] >= Styles.Num() || (ImageIndices[Line] != INDEX_NONE && !Images.IsValidIndex(ImageIndices[Line]))
+			|| (uint8)Kinds[Line] > (uint8)ECreditsLineKind::Image)
+		{
+			return false;
+		}
+	}
+	for (int32 Section = 0; Section < NumSections; ++Section)
+	{
+		// the section ranges are found by binary search, so they must be in order and inside the lines.
+		if (SectionStarts[Section] < (Section > 0 ? SectionStarts[Section - 1] : 0) || SectionStarts[Section] > NumLines)
+		{
+			return false;
+		}
+	}
+	for (int32 AssetIndex = 0; AssetIndex < AssetStarts.Num(); ++AssetIndex)
+	{
+		if (AssetStarts[AssetIndex] < 0 || AssetLengths[AssetIndex] < 0 || AssetStarts[AssetIndex] > AssetPool.Num() - AssetLengths[AssetIndex])
+		{
+			return false;
+		}
+	}
+	for (const FCreditsBinaryStyle& Style : Styles)
+	{
+		if (Style.FontAsset < INDEX_NONE || Style.FontAsset >= AssetStarts.Num() || Style.FontMaterialAsset < INDEX_NONE || Style.FontMaterialAsset >= AssetStarts.Num())
+		{
+			return false;
+		}
+	}
+	for (const FCreditsBinaryImage& Image : Images)
+	{
+		if (!AssetStarts.IsValidIndex(Image.Asset))
+		{
+			return false;
+		}
+	}
+
+	Header = &FileHeader;
+	return true;
+}
+
+FStringView FCreditsMappedCredits::GetAssetPath(int32 AssetIndex) const
+{
+	return AssetStarts.IsValidIndex(AssetIndex) ? FStringView(AssetPool.GetData() + AssetStarts[AssetIndex], AssetLengths[AssetIndex]) : FStringView();
+}
+
+float FCreditsMappedCredits::GetTotalHeight() const
+{
+	return Header ? Header->TotalHeight : 0.0f;
+}
+
+int64 FCreditsMappedCredits::GetMappedSize() const
+{
+	return MappedRegion ? MappedRegion->GetMappedSize() : FallbackData.Num();
+}
+
+/** Returns the loaded asset at AssetIndex of Credits, null for INDEX_NONE. */
+template<typename ObjectType>
+static ObjectType* ResolveCreditsAsset(const FCreditsMappedCredits& Credits, int32 AssetIndex)
+{
+	return AssetIndex == INDEX_NONE ? nullptr : Cast<ObjectType>(FSoftObjectPath(FString(Credits.GetAssetPath(AssetIndex))).ResolveObject());
+}
+
+void FCreditsMappedCredits::GetAssetsToLoad(TArray<FSoftObjectPath>& OutPaths) const
+{
+	TBitArray<> bAdded(false, AssetStarts.Num());
+	auto AddAsset = [this, &bAdded, &OutPaths](int32 AssetIndex)
+	{
+		if (AssetIndex != INDEX_NONE && !bAdded[AssetIndex])
+		{
+			bAdded[AssetIndex] = true;
+			OutPaths.Emplace(FString(GetAssetPath(AssetIndex)));
+		}
+	};
+
+	for (const FCreditsBinaryStyle& Stored : Styles)
+	{
+		AddAsset(Stored.FontAsset);
+		AddAsset(Stored.FontMaterialAsset);
+	}
+
+	// soft images are left to the asset streamer.
+	for (const FCreditsBinaryImage& Stored : Images)
+	{
+		if (!Stored.bSoft)
+		{
+			AddAsset(Stored.Asset);
+		}
+	}
+}
+
+TSharedPtr<FStreamableHandle> FCreditsMappedCredits::RequestAssets(FStreamableDelegate OnLoaded) const
+{
+	TArray<FSoftObjectPath> Paths;
+	GetAssetsToLoad(Paths);
+	if (Paths.Num() == 0)
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+	return FCreditsAssetStreamer::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths), MoveTemp(OnLoaded));
+}
+
+bool FCreditsMappedCredits::ToCompiledCredits(FCreditsCompiledCredits& Out) const
+{
+	check(IsInGameThread());
+	Out.Reset();
+	if (!IsOpen())
+	{
+		return false;
+	}
+
+	// whatever RequestAssets did not load yet is loaded in one batch, rather than one blocking load per asset.
+	TArray<FSoftObjectPath> Unloaded;
+	GetAssetsToLoad(Unloaded);
+	Unloaded.RemoveAllSwap([](const FSoftObjectPath& Path)
+	{
+		return Path.ResolveObject() != nullptr;
+	});
+	const TSharedPtr<FStreamableHandle> LoadHandle = Unloaded.Num() > 0 ? FCreditsAssetStreamer::GetStreamableManager().RequestSyncLoad(MoveTemp(Unloaded)) : nullptr;
+
+	FCreditsLineTable& Lines = Out.Lines;
+	Lines.StringPool = FString(StringPool.Num(), StringPool.GetData());
+	Lines.TextStarts.Append(TextStarts.GetData(), TextStarts.Num());
+	Lines.TextLengths.Append(TextLengths.GetData(), TextLengths.Num());
+	Lines.StyleIndices.Append(StyleIndices.GetData(), StyleIndices.Num());
+	Lines.ImageIndices.Append(ImageIndices.GetData(), ImageIndices.Num());
+	Lines.OffsetsY.Append(OffsetsY.GetData(), OffsetsY.Num());
+	Lines.Widths.Append(Widths.GetData(), Widths.Num());
+	Lines.Heights.Append(Heights.GetData(), Heights.Num());
+	Lines.Kinds.Append(Kinds.GetData(), Kinds.Num());
+	Lines.Flags.Append(Flags.GetData(), Flags.Num());
+	Lines.SectionStarts.Append(SectionStarts.GetData(), SectionStarts.Num());
+	Lines.SectionPaddingTop.Append(SectionPaddingTop.GetData(), SectionPaddingTop.Num());
+	Lines.SectionPaddingBottom.Append(SectionPaddingBottom.GetData(), SectionPaddingBottom.Num());
+	Lines.bMeasured = Header->bMeasured != 0;
+
+	// the section tops are not stored, laying the stored heights out again derives them along with the same offsets.
+	Lines.UpdateOffsets();
+
+	// styles that only differed by an asset which failed to load collapse into one, the lines follow them.
+	TArray<uint16> StyleRemap;
+	StyleRemap.SetNum(Styles.Num());
+	bool bStylesMoved = false;
+	for (int32 StyleIndex = 0; StyleIndex < Styles.Num(); ++StyleIndex)
+	{
+		const FCreditsBinaryStyle& Stored = Styles[StyleIndex];
+		FCreditsLineStyle Style;
+		Style.Font = ResolveCreditsAsset<UFont>(*this, Stored.FontAsset);
+		Style.FontMaterial = ResolveCreditsAsset<UMaterialInterface>(*this, Stored.FontMaterialAsset);
+		Style.FontSize = Stored.FontSize;
+		Style.Color = Stored.Color;
+		Style.Padding = FCreditsPaddingMargin(Stored.Padding[0], Stored.Padding[1], Stored.Padding[2], Stored.Padding[3]);
+		Style.ImageSizeOverride = Stored.ImageSizeOverride != 0;
+		Style.ImageSizeProperties = FVector2D(Stored.ImageSize[0], Stored.ImageSize[1]);
+
+		StyleRemap[StyleIndex] = Out.Styles.Intern(Style);
+		bStylesMoved |= StyleRemap[StyleIndex] != StyleIndex;
+	}
+	if (bStylesMoved)
+	{
+		for (uint16& StyleIndex : Lines.StyleIndices)
+		{
+			StyleIndex = StyleRemap[StyleIndex];
+		}
+	}
+
+	for (const FCreditsBinaryImage& Stored : Images)
+	{
+		const FSoftObjectPath Path(FString(GetAssetPath(Stored.Asset)));
+		UTexture2D* Texture = Cast<UTexture2D>(Path.ResolveObject());
+		Out.AddImage(Path, Texture, FVector2D(Stored.NativeSize[0], Stored.NativeSize[1]), Stored.bSoft != 0);
+	}
+	return true;
+}
@@ -2,6 +2,7 @@
 
 #include "CreditsBlueprintLibrary.h"
 #include "Classes/FCreditsProperties.h" // @todo still WIP while we refactor and get c++ properties using unreal macros.
+#include "CreditsConverter.h"
 #include "CreditsModule.h"
 
 UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& ObjectInitializer)
@@ -24,7 +25,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	StopQueueingMusicWhenCreditsEnded
 	 * @return	FCreditsGeneralSettings
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsGeneralSettings(FCreditsGeneralSettings GeneralSettings, UCurveFloat*& SpeedCurve, UCurveFloat*& OpacityCurve, UCurveFloat*& VolumeCurve, ECreditsStartingPosition& CreditsStartingPosition, bool& TimeDilationEffectsCredits, bool& AutoPlayMusic, bool& RestartMusicAtEnd, bool& EndCreditsOnEndReached, bool& StopMusicOnCreditsEnded, bool& StopQueueingMusicWhenCreditsEnded)
+	void UCreditsBlueprintLibrary::BreakCreditsGeneralSettings(const FCreditsGeneralSettings& GeneralSettings, UCurveFloat*& SpeedCurve, UCurveFloat*& OpacityCurve, UCurveFloat*& VolumeCurve, ECreditsStartingPosition& CreditsStartingPosition, bool& TimeDilationEffectsCredits, bool& AutoPlayMusic, bool& RestartMusicAtEnd, bool& EndCreditsOnEndReached, bool& StopMusicOnCreditsEnded, bool& StopQueueingMusicWhenCreditsEnded)
 	{
 		SpeedCurve = GeneralSettings.SpeedCurve;
 		OpacityCurve = GeneralSettings.OpacityCurve;
@@ -62,13 +63,15 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Image
 	 * @param	ImageSizeOverride
 	 * @param	ImageSizeProperties
+	 * @param	SoftImage
 	 * @return	FCreditsImageProperties
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsImageProperties(FCreditsImageProperties ImageProperties, UTexture2D*& Image, bool& ImageSizeOverride, FVector2D& ImageSizeProperties)
+	void UCreditsBlueprintLibrary::BreakCreditsImageProperties(const FCreditsImageProperties& ImageProperties, UTexture2D*& Image, bool& ImageSizeOverride, FVector2D& ImageSizeProperties, TSoftObjectPtr<UTexture2D>& SoftImage)
 	{
 		Image = ImageProperties.Image;
 		ImageSizeOverride = ImageProperties.ImageSizeOverride;
 		ImageSizeProperties = ImageProperties.ImageSizeProperties;
+		SoftImage = ImageProperties.SoftImage;
 	}
 
 	/**
@@ -76,11 +79,12 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Image
 	 * @param	ImageSizeOverride
 	 * @param	ImageSizeProperties
+	 * @param	SoftImage
 	 * @return	FCreditsImageProperties
 	 */
-	FCreditsImageProperties UCreditsBlueprintLibrary::MakeCreditsImageProperties(UTexture2D* Image, bool ImageSizeOverride, FVector2D ImageSizeProperties)
+	FCreditsImageProperties UCreditsBlueprintLibrary::MakeCreditsImageProperties(UTexture2D* Image, bool ImageSizeOverride, const FVector2D& ImageSizeProperties, const TSoftObjectPtr<UTexture2D>& SoftImage)
 	{
-		return FCreditsImageProperties(Image, ImageSizeOverride, ImageSizeProperties);
+		return FCreditsImageProperties(Image, ImageSizeOverride, ImageSizeProperties, SoftImage);
 	}
 
 	/**
@@ -92,7 +96,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @return	FCreditsMusic
 	 */
 	 
-	void UCreditsBlueprintLibrary::BreakCreditsMusic(FCreditsMusic CreditsMusic, USoundWave*& Audio, ECreditsSoundQueueMode& QueueMode, float& StartTime, float& PlayDelay)
+	void UCreditsBlueprintLibrary::BreakCreditsMusic(const FCreditsMusic& CreditsMusic, USoundWave*& Audio, ECreditsSoundQueueMode& QueueMode, float& StartTime, float& PlayDelay)
 	{
 		Audio = CreditsMusic.Audio;
 		QueueMode = CreditsMusic.QueueMode;
@@ -121,7 +125,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsNameOverrides
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsNameOverrides(FCreditsNameOverrides CreditsNameOverrides, FName& ParentSection, FName& ParentRole, FName& NameToOverride, FCreditsNameTextObject& OverrideData)
+	void UCreditsBlueprintLibrary::BreakCreditsNameOverrides(const FCreditsNameOverrides& CreditsNameOverrides, FName& ParentSection, FName& ParentRole, FName& NameToOverride, FCreditsNameTextObject& OverrideData)
 	{
 		ParentSection = CreditsNameOverrides.ParentSection;
 		ParentRole = CreditsNameOverrides.ParentRole;
@@ -137,7 +141,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsNameOverrides
 	 */
-	FCreditsNameOverrides UCreditsBlueprintLibrary::MakeCreditsNameOverrides(FName ParentSection, FName ParentRole, FName NameToOverride, FCreditsNameTextObject OverrideData)
+	FCreditsNameOverrides UCreditsBlueprintLibrary::MakeCreditsNameOverrides(FName ParentSection, FName ParentRole, FName NameToOverride, const FCreditsNameTextObject& OverrideData)
 	{
 		return FCreditsNameOverrides(ParentSection, ParentRole, NameToOverride, OverrideData);
 	}
@@ -149,7 +153,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Padding
 	 * @return	FCreditsNameTextObject
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsNameTextObject(FCreditsNameTextObject CreditsNameTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding)
+	void UCreditsBlueprintLibrary::BreakCreditsNameTextObject(const FCreditsNameTextObject& CreditsNameTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding)
 	{
 		TextProperties = CreditsNameTextObject.TextProperties;
 		ImageProperties = CreditsNameTextObject.ImageProperties;
@@ -163,7 +167,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Padding
 	 * @return	FCreditsNameTextObject
 	 */
-	FCreditsNameTextObject UCreditsBlueprintLibrary::MakeCreditsNameTextObject(FCreditsTextProperties TextProperties, FCreditsImageProperties ImageProperties, FCreditsPaddingMargin Padding)
+	FCreditsNameTextObject UCreditsBlueprintLibrary::MakeCreditsNameTextObject(const FCreditsTextProperties& TextProperties, const FCreditsImageProperties& ImageProperties, const FCreditsPaddingMargin& Padding)
 	{
 		return FCreditsNameTextObject(TextProperties, ImageProperties, Padding);
 	}
@@ -176,7 +180,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	NameOverrides
 	 * @return	FCreditsOverrides
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsOverrides(FCreditsOverrides Overrides, FCreditsSectionOverride& SectionOverride, bool& IsOverridingSection, TArray<FCreditsRoleOverride>& RoleOverrides, TArray<FCreditsNameOverrides>& NameOverrides)
+	void UCreditsBlueprintLibrary::BreakCreditsOverrides(const FCreditsOverrides& Overrides, FCreditsSectionOverride& SectionOverride, bool& IsOverridingSection, TArray<FCreditsRoleOverride>& RoleOverrides, TArray<FCreditsNameOverrides>& NameOverrides)
 	{
 		SectionOverride = Overrides.SectionOverride;
 		IsOverridingSection = Overrides.IsOverridingSection;
@@ -192,7 +196,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	NameOverrides
 	 * @return	FCreditsOverrides
 	 */
-	FCreditsOverrides UCreditsBlueprintLibrary::MakeCreditsOverrides(FCreditsSectionOverride SectionOverride, bool IsOverridingSection, TArray<FCreditsRoleOverride> RoleOverrides, TArray<FCreditsNameOverrides> NameOverrides)
+	FCreditsOverrides UCreditsBlueprintLibrary::MakeCreditsOverrides(const FCreditsSectionOverride& SectionOverride, bool IsOverridingSection, const TArray<FCreditsRoleOverride>& RoleOverrides, const TArray<FCreditsNameOverrides>& NameOverrides)
 	{
 		return FCreditsOverrides(SectionOverride, IsOverridingSection, RoleOverrides, NameOverrides);
 	}
@@ -205,7 +209,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Bottom
 	 * @return	FCreditsPaddingMargin
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsPaddingMargin(FCreditsPaddingMargin Padding, float& Left, float& Top, float& Right, float& Bottom)
+	void UCreditsBlueprintLibrary::BreakCreditsPaddingMargin(const FCreditsPaddingMargin& Padding, float& Left, float& Top, float& Right, float& Bottom)
 	{
 		Left = Padding.Left;
 		Top = Padding.Top;
@@ -232,7 +236,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	PlayedByNames
 	 * @return	FCreditsRole
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsRole(FCreditsRole CreditsRole, FCreditsRoleDefaults& RoleProperties, TArray<FCreditsNameTextObject>& PlayedByNames)
+	void UCreditsBlueprintLibrary::BreakCreditsRole(const FCreditsRole& CreditsRole, FCreditsRoleDefaults& RoleProperties, TArray<FCreditsNameTextObject>& PlayedByNames)
 	{
 		RoleProperties = CreditsRole.RoleProperties;
 		PlayedByNames = CreditsRole.PlayedByNames;
@@ -244,7 +248,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	PlayedByNames
 	 * @return	FCreditsRole
 	 */
-	FCreditsRole UCreditsBlueprintLibrary::MakeCreditsRole(FCreditsRoleDefaults RoleProperties, TArray<FCreditsNameTextObject> PlayedByNames)
+	FCreditsRole UCreditsBlueprintLibrary::MakeCreditsRole(const FCreditsRoleDefaults& RoleProperties, const TArray<FCreditsNameTextObject>& PlayedByNames)
 	{
 		return FCreditsRole(RoleProperties, PlayedByNames);
 	}
@@ -256,7 +260,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	DisplayRoleName
 	 * @return	FCreditsRoleDefaults
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsRoleDefaults(FCreditsRoleDefaults RoleDefaults, FCreditsTextObject& Role, ECreditsTextPosition& RolePosition, bool& DisplayRoleName)
+	void UCreditsBlueprintLibrary::BreakCreditsRoleDefaults(const FCreditsRoleDefaults& RoleDefaults, FCreditsTextObject& Role, ECreditsTextPosition& RolePosition, bool& DisplayRoleName)
 	{
 		Role = RoleDefaults.Role;
 		RolePosition = RoleDefaults.RolePosition;
@@ -270,7 +274,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	DisplayRoleName
 	 * @return	FCreditsRoleDefaults
 	 */
-	FCreditsRoleDefaults UCreditsBlueprintLibrary::MakeCreditsRoleDefaults(FCreditsTextObject Role, ECreditsTextPosition RolePosition, bool DisplayRoleName)
+	FCreditsRoleDefaults UCreditsBlueprintLibrary::MakeCreditsRoleDefaults(const FCreditsTextObject& Role, ECreditsTextPosition RolePosition, bool DisplayRoleName)
 	{
 		return FCreditsRoleDefaults(Role, RolePosition, DisplayRoleName);
 	}
@@ -282,7 +286,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsRoleOverride
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsRoleOverride(FCreditsRoleOverride CreditsRoleOverride, FName& ParentSection, FName& RoleToOverride, FCreditsRoleDefaults& OverrideData)
+	void UCreditsBlueprintLibrary::BreakCreditsRoleOverride(const FCreditsRoleOverride& CreditsRoleOverride, FName& ParentSection, FName& RoleToOverride, FCreditsRoleDefaults& OverrideData)
 	{
 		ParentSection = CreditsRoleOverride.ParentSection;
 		RoleToOverride = CreditsRoleOverride.RoleToOverride;
@@ -296,7 +300,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsRoleOverride
 	 */
-	FCreditsRoleOverride UCreditsBlueprintLibrary::MakeCreditsRoleOverride(FName ParentSection, FName RoleToOverride, FCreditsRoleDefaults OverrideData)
+	FCreditsRoleOverride UCreditsBlueprintLibrary::MakeCreditsRoleOverride(FName ParentSection, FName RoleToOverride, const FCreditsRoleDefaults& OverrideData)
 	{
 		return FCreditsRoleOverride(ParentSection, RoleToOverride, OverrideData);
 	}
@@ -308,7 +312,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	PlayedBy
 	 * @return	FCreditsRoleStructSimple
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsRoleStructSimple(FCreditsRoleStructSimple CreditsRoleStructSimple, FCreditsTextObjectSimple& Role, bool& DisplayRoleName, TArray<FCreditsTextObjectSimple>& PlayedBy)
+	void UCreditsBlueprintLibrary::BreakCreditsRoleStructSimple(const FCreditsRoleStructSimple& CreditsRoleStructSimple, FCreditsTextObjectSimple& Role, bool& DisplayRoleName, TArray<FCreditsTextObjectSimple>& PlayedBy)
 	{
 		Role = CreditsRoleStructSimple.Role;
 		DisplayRoleName = CreditsRoleStructSimple.DisplayRoleName;
@@ -322,7 +326,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	PlayedBy
 	 * @return	FCreditsRoleStructSimple
 	 */
-	FCreditsRoleStructSimple UCreditsBlueprintLibrary::MakeCreditsRoleStructSimple(FCreditsTextObjectSimple Role, bool DisplayRoleName, TArray<FCreditsTextObjectSimple> PlayedBy)
+	FCreditsRoleStructSimple UCreditsBlueprintLibrary::MakeCreditsRoleStructSimple(const FCreditsTextObjectSimple& Role, bool DisplayRoleName, const TArray<FCreditsTextObjectSimple>& PlayedBy)
 	{
 		return FCreditsRoleStructSimple(Role, DisplayRoleName, PlayedBy);
 	}
@@ -333,7 +337,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Roles
 	 * @return	FCreditsSection
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsSection(FCreditsSection CreditsSection, FCreditsSectionDefaults& SectionProperties, TArray<FCreditsRole>& Roles)
+	void UCreditsBlueprintLibrary::BreakCreditsSection(const FCreditsSection& CreditsSection, FCreditsSectionDefaults& SectionProperties, TArray<FCreditsRole>& Roles)
 	{
 		SectionProperties = CreditsSection.SectionProperties;
 		Roles = CreditsSection.Roles;
@@ -345,7 +349,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Roles
 	 * @return	FCreditsSection
 	 */
-	FCreditsSection UCreditsBlueprintLibrary::MakeCreditsSection(FCreditsSectionDefaults SectionProperties, TArray<FCreditsRole> Roles)
+	FCreditsSection UCreditsBlueprintLibrary::MakeCreditsSection(const FCreditsSectionDefaults& SectionProperties, const TArray<FCreditsRole>& Roles)
 	{
 		return FCreditsSection(SectionProperties, Roles);
 	}
@@ -357,7 +361,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	SectionPadding
 	 * @return	FCreditsSectionDefaults
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsSectionDefaults(FCreditsSectionDefaults CreditsSectionDefaults, FCreditsTextObject& Title, ECreditsStartingPosition& TitlePosition, FCreditsPaddingMargin& SectionPadding)
+	void UCreditsBlueprintLibrary::BreakCreditsSectionDefaults(const FCreditsSectionDefaults& CreditsSectionDefaults, FCreditsTextObject& Title, ECreditsStartingPosition& TitlePosition, FCreditsPaddingMargin& SectionPadding)
 	{
 		Title = CreditsSectionDefaults.Title;
 		TitlePosition = CreditsSectionDefaults.TitlePosition;
@@ -371,7 +375,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	SectionPadding
 	 * @return	FCreditsSectionDefaults
 	 */
-	FCreditsSectionDefaults UCreditsBlueprintLibrary::MakeCreditsSectionDefaults(FCreditsTextObject Title, ECreditsStartingPosition TitlePosition, FCreditsPaddingMargin SectionPadding)
+	FCreditsSectionDefaults UCreditsBlueprintLibrary::MakeCreditsSectionDefaults(const FCreditsTextObject& Title, ECreditsStartingPosition TitlePosition, const FCreditsPaddingMargin& SectionPadding)
 	{
 		return FCreditsSectionDefaults(Title, TitlePosition, SectionPadding);
 	}
@@ -381,7 +385,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsSectionOverride
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsSectionOverride(FCreditsSectionOverride CreditsSectionOverride, FCreditsSectionDefaults& OverrideData)
+	void UCreditsBlueprintLibrary::BreakCreditsSectionOverride(const FCreditsSectionOverride& CreditsSectionOverride, FCreditsSectionDefaults& OverrideData)
 	{
 		OverrideData = CreditsSectionOverride.OverrideData;
 	}
@@ -391,7 +395,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	OverrideData
 	 * @return	FCreditsSectionOverride
 	 */
-	FCreditsSectionOverride UCreditsBlueprintLibrary::MakeCreditsSectionOverride(FCreditsSectionDefaults OverrideData)
+	FCreditsSectionOverride UCreditsBlueprintLibrary::MakeCreditsSectionOverride(const FCreditsSectionDefaults& OverrideData)
 	{
 		return FCreditsSectionOverride(OverrideData);
 	}
@@ -402,7 +406,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Roles
 	 * @return	FCreditsSectionSimple
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsSectionSimple(FCreditsSectionSimple CreditsSectionSimple, FCreditsTextObjectSimple& Title, TArray<FCreditsRoleStructSimple>& Roles)
+	void UCreditsBlueprintLibrary::BreakCreditsSectionSimple(const FCreditsSectionSimple& CreditsSectionSimple, FCreditsTextObjectSimple& Title, TArray<FCreditsRoleStructSimple>& Roles)
 	{
 		Title = CreditsSectionSimple.Title;
 		Roles = CreditsSectionSimple.Roles;
@@ -414,7 +418,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Roles
 	 * @return	FCreditsSectionSimple
 	 */
-	FCreditsSectionSimple UCreditsBlueprintLibrary::MakeCreditsSectionSimple(FCreditsTextObjectSimple Title, TArray<FCreditsRoleStructSimple> Roles)
+	FCreditsSectionSimple UCreditsBlueprintLibrary::MakeCreditsSectionSimple(const FCreditsTextObjectSimple& Title, const TArray<FCreditsRoleStructSimple>& Roles)
 	{
 		return FCreditsSectionSimple(Title, Roles);
 	}
@@ -426,7 +430,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Padding
 	 * @return	FCreditsTextObject
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsTextObject(FCreditsTextObject CreditsTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding)
+	void UCreditsBlueprintLibrary::BreakCreditsTextObject(const FCreditsTextObject& CreditsTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding)
 	{
 		TextProperties = CreditsTextObject.TextProperties;
 		ImageProperties = CreditsTextObject.ImageProperties;
@@ -440,7 +444,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Padding
 	 * @return	FCreditsTextObject
 	 */
-	FCreditsTextObject UCreditsBlueprintLibrary::MakeCreditsTextObject(FCreditsTextProperties TextProperties, FCreditsImageProperties ImageProperties, FCreditsPaddingMargin Padding)
+	FCreditsTextObject UCreditsBlueprintLibrary::MakeCreditsTextObject(const FCreditsTextProperties& TextProperties, const FCreditsImageProperties& ImageProperties, const FCreditsPaddingMargin& Padding)
 	{
 		return FCreditsTextObject(TextProperties, ImageProperties, Padding);
 	}
@@ -451,7 +455,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	ImageProperties
 	 * @return	FCreditsTextObjectSimple
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsTextObjectSimple(FCreditsTextObjectSimple CreditsTextObjectSimple, FString& Text, FCreditsImageProperties& ImageProperties)
+	void UCreditsBlueprintLibrary::BreakCreditsTextObjectSimple(const FCreditsTextObjectSimple& CreditsTextObjectSimple, FString& Text, FCreditsImageProperties& ImageProperties)
 	{
 		Text = CreditsTextObjectSimple.Text;
 		ImageProperties = CreditsTextObjectSimple.ImageProperties;
@@ -463,7 +467,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	ImageProperties
 	 * @return	FCreditsTextObjectSimple
 	 */
-	FCreditsTextObjectSimple UCreditsBlueprintLibrary::MakeCreditsTextObjectSimple(FString Text, FCreditsImageProperties ImageProperties)
+	FCreditsTextObjectSimple UCreditsBlueprintLibrary::MakeCreditsTextObjectSimple(const FString& Text, const FCreditsImageProperties& ImageProperties)
 	{
 		return FCreditsTextObjectSimple(Text, ImageProperties);
 	}
@@ -477,7 +481,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Color
 	 * @return	FCreditsTextProperties
 	 */
-	void UCreditsBlueprintLibrary::BreakCreditsTextProperties(FCreditsTextProperties Properties, FString& Title, UFont*& Font, UMaterialInterface*& FontMaterial, int& FontSize, FLinearColor& Color)
+	void UCreditsBlueprintLibrary::BreakCreditsTextProperties(const FCreditsTextProperties& Properties, FString& Title, UFont*& Font, UMaterialInterface*& FontMaterial, int& FontSize, FLinearColor& Color)
 	{
 		Title = Properties.Title;
 		Font = Properties.Font;
@@ -495,7 +499,7 @@ UCreditsBlueprintLibrary::UCreditsBlueprintLibrary(const FObjectInitializer& Obj
 	 * @param	Color
 	 * @return	FCreditsTextProperties
 	 */
-	FCreditsTextProperties UCreditsBlueprintLibrary::MakeCreditsTextProperties(FString Title, UFont* Font, UMaterialInterface* FontMaterial, int FontSize, FLinearColor Color)
+	FCreditsTextProperties UCreditsBlueprintLibrary::MakeCreditsTextProperties(const FString& Title, UFont* Font, UMaterialInterface* FontMaterial, int FontSize, const FLinearColor& Color)
 	{
 		return FCreditsTextProperties(Title, Font, FontMaterial, FontSize, Color);
 	}
@@ -524,47 +528,57 @@ void UCreditsBlueprintLibrary::PaddingMarginToMargin(FCreditsPaddingMargin A, UO
 }
 
 /**
-	TArray<FCreditsRoleOverride>
+	Roles converted without a parent section match their overrides on the role and name alone.
 */
-void UCreditsBlueprintLibrary::SimpleRolesToComplexRoles(TArray<FCreditsRoleStructSimple> SimpleRole, TArray<FCreditsRoleOverride> RoleOverrides, TArray<FCreditsNameOverrides> NameOverrides, UObject* WorldContextObject, TArray<FCreditsRole>& ComplexRole)
+void UCreditsBlueprintLibrary::SimpleRolesToComplexRoles(const TArray<FCreditsRoleStructSimple>& SimpleRole, const TArray<FCreditsRoleOverride>& RoleOverrides, const TArray<FCreditsNameOverrides>& NameOverrides, UObject* WorldContextObject, TArray<FCreditsRole>& ComplexRole)
 {
-	/* Set the Role Defaults to the default values in the Role struct */
-	FCreditsRoleDefaults RoleDefaults;
-	/* TempComplexRoles */
-	TArray<FCreditsRoleStructSimple> TempComplexRoles;
-	FCreditsProperties GroupMatch;
-	GroupMatch.MatchNumber = 10;
-	UE_LOG(ClosingCreditsLog, Warning, TEXT("UCreditsBlueprintLibrary::SimpleRolesToComplexRoles"));
-	//MatchNumber = 10;
-	//CaptureGroupNumber = 10;
-	//FontSize = 10;
-
-
-	for (uint32 Index = 0; Index; ++Index)
+	FCreditsOverrideIndex Index;
+	for (const FCreditsRoleOverride& Override : RoleOverrides)
 	{
-		//
+		Index.AddRoleOverride(FCreditsRoleOverride(NAME_None, Override.RoleToOverride, Override.OverrideData));
 	}
-	//return;
+	for (const FCreditsNameOverrides& Override : NameOverrides)
+	{
+		Index.AddNameOverride(FCreditsNameOverrides(NAME_None, Override.ParentRole, Override.NameToOverride, Override.OverrideData));
+	}
+
+	FCreditsConverter::ConvertRoles(SimpleRole, Index.IsEmpty() ? nullptr : &Index, NAME_None, ComplexRole);
 }
 
-void UCreditsBlueprintLibrary::SimpleTextObjectRoleToComplexTextObject(FCreditsTextObjectSimple Simple, UObject* WorldContextObject, FCreditsTextObject& Complex)
+void UCreditsBlueprintLibrary::SimpleTextObjectRoleToComplexTextObject(const FCreditsTextObjectSimple& Simple, UObject* WorldContextObject, FCreditsTextObject& Complex)
 {
-	//return;
+	FCreditsConverter::ConvertRoleText(Simple, Complex);
 }
 
-void UCreditsBlueprintLibrary::SimplePlayedByNamesToComplexPlayedByNames(TArray<FCreditsTextObjectSimple> Simple, TArray<FCreditsNameOverrides> Overrides, UObject* WorldContextObject, TArray<FCreditsNameTextObject>& Complex)
+void UCreditsBlueprintLibrary::SimplePlayedByNamesToComplexPlayedByNames(const TArray<FCreditsTextObjectSimple>& Simple, const TArray<FCreditsNameOverrides>& Overrides, UObject* WorldContextObject, TArray<FCreditsNameTextObject>& Complex)
 {
-	//return;
+	/* Names converted without a parent role match their overrides on the name alone. */
+	FCreditsOverrideIndex Index;
+	for (const FCreditsNameOverrides& Override : Overrides)
+	{
+		Index.AddNameOverride(FCreditsNameOverrides(NAME_None, NAME_None, Override.NameToOverride, Override.OverrideData));
+	}
+
+	FCreditsConverter::ConvertNames(Simple, Index.IsEmpty() ? nullptr : &Index, NAME_None, NAME_None, Complex);
 }
 
-void UCreditsBlueprintLibrary::SimpleCreditsSectionToComplexCreditsSection(FCreditsSectionSimple Simple, FCreditsOverrides Overrides, UObject* WorldContextObject, FCreditsSection& Complex)
+void UCreditsBlueprintLibrary::SimpleCreditsSectionToComplexCreditsSection(const FCreditsSectionSimple& Simple, const FCreditsOverrides& Overrides, UObject* WorldContextObject, FCreditsSection& Complex)
 {
-	//return;
+	const FName Section(*Simple.Title.Text);
+
+	FCreditsOverrideIndex Index;
+	Index.Build(Overrides.RoleOverrides, Overrides.NameOverrides);
+	if (Overrides.IsOverridingSection)
+	{
+		Index.AddSectionOverride(Section, Overrides.SectionOverride.OverrideData);
+	}
+
+	FCreditsConverter::ConvertSection(Simple, Index.IsEmpty() ? nullptr : &Index, Section, Complex);
 }
 
-void UCreditsBlueprintLibrary::SimpleTextObjectTitleToComplexTextObject(FCreditsTextObjectSimple Simple, UObject* WorldContextObject, FCreditsTextObject& Complex)
+void UCreditsBlueprintLibrary::SimpleTextObjectTitleToComplexTextObject(const FCreditsTextObjectSimple& Simple, UObject* WorldContextObject, FCreditsTextObject& Complex)
 {
-	//return;
+	FCreditsConverter::ConvertTitle(Simple, Complex);
 }
 
 void UCreditsBlueprintLibrary::GetOverridenRoles(FName Section, UObject* WorldContextObject, TArray<FCreditsRoleOverride>& OverridenRoles)
@@ -572,9 +586,24 @@ void UCreditsBlueprintLibrary::GetOverridenRoles(FName Section, UObject* WorldCo
 	//return;
 }
 
-void UCreditsBlueprintLibrary::GetOverrideDataForRole(const FString RoleName, TArray<FCreditsRoleOverride> OverridenRoles, UObject* WorldContextObject, FCreditsRoleDefaults& Data, bool& IsOverriding)
+void UCreditsBlueprintLibrary::GetOverrideDataForRole(const FString& RoleName, const TArray<FCreditsRoleOverride>& OverridenRoles, UObject* WorldContextObject, FCreditsRoleDefaults& Data, bool& IsOverriding, FName Section)
 {
-	//return;
+	/* The most specific override wins, the last one among equals, as when the index is built from the array. */
+	const FName Role(*RoleName);
+	const FCreditsRoleOverride* Best = nullptr;
+	int32 BestRank = 0;
+	for (const FCreditsRoleOverride& Override : OverridenRoles)
+	{
+		const int32 Rank = FCreditsOverrideIndex::GetRoleOverrideRank(Section, Role, FCreditsOverrideKey(Override.ParentSection, Override.RoleToOverride, NAME_None));
+		if (Rank > 0 && Rank >= BestRank)
+		{
+			Best = &Override;
+			BestRank = Rank;
+		}
+	}
+
+	Data = Best ? Best->OverrideData : FCreditsRoleDefaults();
+	IsOverriding = Best != nullptr;
 }
 
 void UCreditsBlueprintLibrary::GetOverridenNames(FName Section, UObject* WorldContextObject, TArray<FCreditsNameOverrides>& OverridenRoles)
@@ -587,7 +616,50 @@ void UCreditsBlueprintLibrary::GetRolesInSection(FName Section, UObject* WorldCo
 	//return;
 }
 
-void UCreditsBlueprintLibrary::GetOverrideDataForName(const FString Name, TArray<FCreditsNameOverrides> OverridenNames, UObject* WorldContextObject, FCreditsNameOverrides& Data, bool& IsOverriding)
+void UCreditsBlueprintLibrary::GetOverrideDataForName(const FString& Name, const TArray<FCreditsNameOverrides>& OverridenNames, UObject* WorldContextObject, FCreditsNameOverrides& Data, bool& IsOverriding, FName Section, FName Role)
 {
-	//return;
+	/* The most specific override wins, the last one among equals, as when the index is built from the array. */
+	const FName NameToOverride(*Name);
+	const FCreditsNameOverrides* Best = nullptr;
+	int32 BestRank = 0;
+	for (const FCreditsNameOverrides& Override : OverridenNames)
+	{
+		const int32 Rank = FCreditsOverrideIndex::GetNameOverrideRank(Section, Role, NameToOverride, FCreditsOverrideKey(Override.ParentSection, Override.ParentRole, Override.NameToOverride));
+		if (Rank > 0 && Rank >= BestRank)
+		{
+			Best = &Override;
+			BestRank = Rank;
+		}
+	}
+
+	Data = Best ? *Best : FCreditsNameOverrides();
+	IsOverriding = Best != nullptr;
+}
+
+FCreditsOverrideIndexHandle UCreditsBlueprintLibrary::BuildCreditsOverrideIndex(const UDataTable* SectionOverrides, const UDataTable* RoleOverrides, const UDataTable* NameOverrides)
+{
+	TSharedRef<FCreditsOverrideIndex> Index = MakeShared<FCreditsOverrideIndex>();
+	Index->Build(SectionOverrides, RoleOverrides, NameOverrides);
+	return FCreditsOverrideIndexHandle(Index);
+}
+
+void UCreditsBlueprintLibrary::FindSectionOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FCreditsSectionDefaults& Data, bool& IsOverriding)
+{
+	const FCreditsSectionDefaults* Found = Index.IsValid() ? Index.Index->FindSectionOverride(Section) : nullptr;
+	Data = Found ? *Found : FCreditsSectionDefaults();
+	IsOverriding = Found != nullptr;
+}
+
+void UCreditsBlueprintLibrary::FindRoleOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FName Role, FCreditsRoleDefaults& Data, bool& IsOverriding)
+{
+	const FCreditsRoleDefaults* Found = Index.IsValid() ? Index.Index->FindRoleOverride(Section, Role) : nullptr;
+	Data = Found ? *Found : FCreditsRoleDefaults();
+	IsOverriding = Found != nullptr;
+}
+
+void UCreditsBlueprintLibrary::FindNameOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FName Role, FName Name, FCreditsNameTextObject& Data, bool& IsOverriding)
+{
+	const FCreditsNameTextObject* Found = Index.IsValid() ? Index.Index->FindNameOverride(Section, Role, Name) : nullptr;
+	Data = Found ? *Found : FCreditsNameTextObject();
+	IsOverriding = Found != nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsBuilder.h"
+
+FCreditsBuilder::FCreditsBuilder()
+	: Sections()
+	, DefaultName()
+{
+}
+
+FCreditsBuilder& FCreditsBuilder::Reserve(int32 NumSections)
+{
+	Sections.Reserve(NumSections);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddSection(const FCreditsSectionDefaults& SectionProperties, int32 NumRoles)
+{
+	Sections.Emplace_GetRef(SectionProperties, TArray<FCreditsRole>()).Roles.Reserve(NumRoles);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddSection(FCreditsSectionDefaults&& SectionProperties, int32 NumRoles)
+{
+	Sections.Emplace_GetRef(MoveTemp(SectionProperties), TArray<FCreditsRole>()).Roles.Reserve(NumRoles);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddSection(FCreditsSection&& Section)
+{
+	Sections.Emplace(MoveTemp(Section));
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddRole(const FCreditsRoleDefaults& RoleProperties, int32 NumNames)
+{
+	checkf(Sections.Num() > 0, TEXT("FCreditsBuilder: a section must be added before its roles"));
+	Sections.Last().Roles.Emplace_GetRef(RoleProperties, TArray<FCreditsNameTextObject>()).PlayedByNames.Reserve(NumNames);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddRole(FCreditsRoleDefaults&& RoleProperties, int32 NumNames)
+{
+	checkf(Sections.Num() > 0, TEXT("FCreditsBuilder: a section must be added before its roles"));
+	Sections.Last().Roles.Emplace_GetRef(MoveTemp(RoleProperties), TArray<FCreditsNameTextObject>()).PlayedByNames.Reserve(NumNames);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddRole(FCreditsRole&& Role)
+{
+	checkf(Sections.Num() > 0, TEXT("FCreditsBuilder: a section must be added before its roles"));
+	Sections.Last().Roles.Emplace(MoveTemp(Role));
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddName(const FCreditsNameTextObject& Name)
+{
+	GetCurrentNames().Add(Name);
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddName(FCreditsNameTextObject&& Name)
+{
+	GetCurrentNames().Emplace(MoveTemp(Name));
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddName(const FString& Text)
+{
+	GetCurrentNames().Add_GetRef(DefaultName).TextProperties.Title = Text;
+	return *this;
+}
+
+FCreditsBuilder& FCreditsBuilder::AddName(FString&& Text)
+{
+	FCreditsNameTextObject& Name = GetCurrentNames().Add_GetRef(DefaultName);
+	Name.TextProperties.Title = MoveTemp(Text);
+	return *this;
+}
+
+TArray<FCreditsSection> FCreditsBuilder::Build()
+{
+	return MoveTemp(Sections);
+}
+
+TArray<FCreditsNameTextObject>& FCreditsBuilder::GetCurrentNames()
+{
+	checkf(Sections.Num() > 0 && Sections.Last().Roles.Num() > 0, TEXT("FCreditsBuilder: a role must be added before its names"));
+	return Sections.Last().Roles.Last().PlayedByNames;
+}
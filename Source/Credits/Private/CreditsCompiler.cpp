@@ -0,0 +1,369 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsCompiler.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/DataTable.h"
+#include "Engine/Texture2D.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UnrealType.h"
+#include "CreditsModule.h"
+#include "CreditsStats.h"
+
+/** Slate sizes fonts in points at 96 DPI, and the engine fonts lay out lines at about 1.2 em. */
+static const float CreditsEstimatedLineHeightScale = (96.0f / 72.0f) * 1.2f;
+
+/** Average advance of a character of the engine fonts, in em. */
+static const float CreditsEstimatedCharWidthScale = (96.0f / 72.0f) * 0.5f;
+
+/** Space between a side role and the column of its names. */
+static const float CreditsColumnGutter = 40.0f;
+
+/** Returns the size of a texture that is not loaded, read from the asset registry so that it stays unloaded. */
+static FVector2D GetUnloadedTextureSize(const FSoftObjectPath& Path)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Path);
+
+	// textures register their size as "WidthxHeight".
+	FString Dimensions;
+	FString Width;
+	FString Height;
+	if (AssetData.GetTagValue(TEXT("Dimensions"), Dimensions) && Dimensions.Split(TEXT("x"), &Width, &Height))
+	{
+		return FVector2D(FCString::Atof(*Width), FCString::Atof(*Height));
+	}
+
+	UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsCompiler: unable to find the size of %s, set an image size override on it"), *Path.ToString());
+	return FVector2D::ZeroVector;
+}
+
+/**
+ * Adds the image of ImageProperties to the image table, soft images that are not loaded yet stay unloaded.
+ * A loaded soft image is only taken when bTakeLoadedSoftImage, otherwise it is left for the caller to set.
+ */
+static int32 AddImage(FCreditsCompiledCredits& Out, const FCreditsImageProperties& ImageProperties, const FSoftObjectPath& ImagePath, bool bTakeLoadedSoftImage = true)
+{
+	// off the game thread only the images added up front by AddTableImages are safe to look at.
+	if (!IsInGameThread())
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsCompiler: %s was not added up front, it is streamed in without a size"), *ImagePath.ToString());
+		return Out.AddImage(ImagePath, nullptr, FVector2D::ZeroVector, true);
+	}
+
+	UTexture2D* Texture = ImageProperties.Image ? ImageProperties.Image : ImageProperties.SoftImage.Get();
+	const FVector2D NativeSize = Texture ? FVector2D(Texture->GetSizeX(), Texture->GetSizeY()) : GetUnloadedTextureSize(ImagePath);
+	const bool bSoft = ImageProperties.Image == nullptr;
+	return Out.AddImage(ImagePath, bSoft && !bTakeLoadedSoftImage ? nullptr : Texture, NativeSize, bSoft);
+}
+
+/** Emits the image and text lines of one credits text object. */
+static void CompileTextObject(FCreditsCompiledCredits& Out, ECreditsLineKind Kind, const FCreditsTextProperties& TextProperties, const FCreditsImageProperties& ImageProperties, const FCreditsPaddingMargin& Padding, uint8 LineFlags)
+{
+	const bool bHasImage = ImageProperties.HasImage();
+	const bool bHasText = !TextProperties.Title.IsEmpty();
+	if (!bHasImage && !bHasText)
+	{
+		return;
+	}
+
+	const uint16 StyleIndex = Out.Styles.Intern(FCreditsLineStyle(TextProperties, ImageProperties, Padding));
+	const FCreditsLineStyle& Style = Out.Styles[StyleIndex];
+
+	// the padding wraps the object, so an image above its text takes the top and the text the bottom.
+	if (bHasImage)
+	{
+		const FSoftObjectPath ImagePath = ImageProperties.GetImagePath();
+		const int32* FoundImage = Out.ImageLookup.Find(ImagePath);
+		const int32 ImageIndex = FoundImage ? *FoundImage : AddImage(Out, ImageProperties, ImagePath);
+
+		const FVector2D& NativeSize = Out.ImageBrushes[ImageIndex].ImageSize;
+		const float ImagePadding = Padding.Top + (bHasText ? 0.0f : Padding.Bottom);
+		Out.Lines.AddLine(ECreditsLineKind::Image, FStringView(), StyleIndex, ImageIndex, FCreditsCompiler::GetImageWidth(Style, NativeSize), FCreditsCompiler::GetImageHeight(Style, NativeSize) + ImagePadding, LineFlags);
+	}
+
+	if (bHasText)
+	{
+		const float TextPadding = Padding.Bottom + (bHasImage ? 0.0f : Padding.Top);
+		Out.Lines.AddLine(Kind, TextProperties.Title, StyleIndex, INDEX_NONE, FCreditsCompiler::EstimateTextWidth(Style, TextProperties.Title.Len()), FCreditsCompiler::EstimateTextHeight(Style) + TextPadding, LineFlags);
+	}
+}
+
+void FCreditsCompiledCredits::Reset()
+{
+	Lines.Reset();
+	Styles.Reset();
+	Images.Reset();
+	ImageBrushes.Reset();
+	ImagePaths.Reset();
+	SoftImages.Reset();
+	ImageLookup.Reset();
+	AtlasPages.Reset();
+}
+
+void FCreditsCompiledCredits::GetLineContentRect(int32 Line, float ViewWidth, FVector2D& OutPosition, FVector2D& OutSize) const
+{
+	const FCreditsLineStyle& Style = Styles[Lines.StyleIndices[Line]];
+	const uint8 LineFlags = Lines.Flags[Line];
+	const float HalfGutter = CreditsColumnGutter * 0.5f;
+
+	float ColumnLeft = 0.0f;
+	float ColumnRight = ViewWidth;
+	if (LineFlags & ECreditsLineFlags::SideColumn)
+	{
+		ColumnRight = ViewWidth * 0.5f - HalfGutter;
+	}
+	else if (LineFlags & ECreditsLineFlags::NameColumn)
+	{
+		ColumnLeft = ViewWidth * 0.5f + HalfGutter;
+	}
+	ColumnLeft += Style.Padding.Left;
+	ColumnRight -= Style.Padding.Right;
+
+	// mirrors CompileTextObject: images take the top padding, text takes the bottom and the top when it stands alone.
+	const bool bImage = Lines.Kinds[Line] == ECreditsLineKind::Image;
+	const bool bFollowsOwnImage = !bImage && Line > 0 && Lines.Kinds[Line - 1] == ECreditsLineKind::Image && Lines.StyleIndices[Line - 1] == Lines.StyleIndices[Line] && Lines.OffsetsY[Line - 1] < Lines.OffsetsY[Line];
+	const float PaddingAbove = bFollowsOwnImage ? 0.0f : Style.Padding.Top;
+	const float PaddingBelow = bImage ? 0.0f : Style.Padding.Bottom;
+	const float ContentHeight = FMath::Max(0.0f, Lines.Heights[Line] - PaddingAbove - PaddingBelow);
+
+	if (bImage)
+	{
+		const float ImageWidth = Lines.Widths[Line];
+		OutPosition = FVector2D((ColumnLeft + ColumnRight - ImageWidth) * 0.5f, Lines.OffsetsY[Line] + PaddingAbove);
+		OutSize = FVector2D(ImageWidth, ContentHeight);
+	}
+	else
+	{
+		OutPosition = FVector2D(ColumnLeft, Lines.OffsetsY[Line] + PaddingAbove);
+		OutSize = FVector2D(FMath::Max(0.0f, ColumnRight - ColumnLeft), ContentHeight);
+	}
+}
+
+int32 FCreditsCompiledCredits::AddImage(const FSoftObjectPath& Path, UTexture2D* Texture, const FVector2D& NativeSize, bool bSoft)
+{
+	FSlateBrush& Brush = ImageBrushes.AddDefaulted_GetRef();
+	Brush.ImageSize = NativeSize;
+
+	ImagePaths.Add(Path);
+	SoftImages.Add(bSoft);
+	const int32 ImageIndex = Images.Add(nullptr);
+	ImageLookup.Add(Path, ImageIndex);
+	SetImage(ImageIndex, Texture);
+	return ImageIndex;
+}
+
+void FCreditsCompiledCredits::SetImage(int32 ImageIndex, UTexture2D* Texture)
+{
+	Images[ImageIndex] = Texture;
+	FSlateBrush& Brush = ImageBrushes[ImageIndex];
+	Brush.SetResourceObject(Texture);
+	Brush.DrawAs = Texture ? ESlateBrushDrawType::Image : ESlateBrushDrawType::NoDrawType;
+}
+
+bool FCreditsCompiledCredits::CompactTables(TArray<int32>& OutImageRemap)
+{
+	OutImageRemap.Reset();
+
+	TBitArray<> bStyleUsed(false, Styles.Num());
+	TBitArray<> bImageUsed(false, Images.Num());
+	int32 NumStylesUsed = 0;
+	int32 NumImagesUsed = 0;
+	for (int32 Line = 0; Line < Lines.Num(); ++Line)
+	{
+		FBitReference StyleUsed = bStyleUsed[Lines.StyleIndices[Line]];
+		NumStylesUsed += StyleUsed ? 0 : 1;
+		StyleUsed = true;
+
+		const int32 ImageIndex = Lines.ImageIndices[Line];
+		if (ImageIndex != INDEX_NONE)
+		{
+			FBitReference ImageUsed = bImageUsed[ImageIndex];
+			NumImagesUsed += ImageUsed ? 0 : 1;
+			ImageUsed = true;
+		}
+	}
+
+	const bool bCompactStyles = NumStylesUsed < Styles.Num();
+	const bool bCompactImages = NumImagesUsed < Images.Num();
+	if (bCompactStyles)
+	{
+		TArray<uint16> StyleRemap;
+		Styles.Compact(bStyleUsed, StyleRemap);
+		for (uint16& StyleIndex : Lines.StyleIndices)
+		{
+			StyleIndex = StyleRemap[StyleIndex];
+		}
+	}
+
+	// the brushes move with their images, so atlas regions stay with the image they show.
+	if (bCompactImages)
+	{
+		OutImageRemap.Init(INDEX_NONE, Images.Num());
+		ImageLookup.Reset();
+		int32 NumKept = 0;
+		for (int32 ImageIndex = 0; ImageIndex < OutImageRemap.Num(); ++ImageIndex)
+		{
+			if (!bImageUsed[ImageIndex])
+			{
+				continue;
+			}
+			if (NumKept != ImageIndex)
+			{
+				Images[NumKept] = Images[ImageIndex];
+				ImageBrushes[NumKept] = MoveTemp(ImageBrushes[ImageIndex]);
+				ImagePaths[NumKept] = MoveTemp(ImagePaths[ImageIndex]);
+				SoftImages[NumKept] = SoftImages[ImageIndex];
+			}
+			OutImageRemap[ImageIndex] = NumKept;
+			ImageLookup.Add(ImagePaths[NumKept], NumKept);
+			++NumKept;
+		}
+		Images.SetNum(NumKept);
+		ImageBrushes.SetNum(NumKept);
+		ImagePaths.SetNum(NumKept);
+		SoftImages.SetNum(NumKept);
+		for (int32& ImageIndex : Lines.ImageIndices)
+		{
+			ImageIndex = ImageIndex != INDEX_NONE ? OutImageRemap[ImageIndex] : INDEX_NONE;
+		}
+	}
+	return bCompactStyles || bCompactImages;
+}
+
+SIZE_T FCreditsCompiledCredits::GetAllocatedSize() const
+{
+	return Lines.GetAllocatedSize() + Styles.GetAllocatedSize() + Images.GetAllocatedSize() + ImageBrushes.GetAllocatedSize() + ImagePaths.GetAllocatedSize() + SoftImages.GetAllocatedSize() + ImageLookup.GetAllocatedSize() + AtlasPages.GetAllocatedSize();
+}
+
+void FCreditsCompiledCredits::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Styles.AddReferencedObjects(Collector);
+	Collector.AddReferencedObjects(Images);
+	Collector.AddReferencedObjects(AtlasPages);
+}
+
+FString FCreditsCompiledCredits::GetReferencerName() const
+{
+	return TEXT("FCreditsCompiledCredits");
+}
+
+void FCreditsCompiler::AddTableImages(const UDataTable* Table, FCreditsCompiledCredits& Out)
+{
+	check(IsInGameThread());
+
+	const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+	if (RowStruct == nullptr)
+	{
+		return;
+	}
+
+	// the image properties are found wherever they sit in a row, so every row type and override is covered.
+	for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+	{
+		for (TPropertyValueIterator<const FStructProperty> It(RowStruct, Row.Value); It; ++It)
+		{
+			if (!It.Key()->Struct->IsChildOf(FCreditsImageProperties::StaticStruct()))
+			{
+				continue;
+			}
+
+			const FCreditsImageProperties& ImageProperties = *static_cast<const FCreditsImageProperties*>(It.Value());
+			if (ImageProperties.HasImage())
+			{
+				const FSoftObjectPath ImagePath = ImageProperties.GetImagePath();
+				if (!Out.ImageLookup.Contains(ImagePath))
+				{
+					AddImage(Out, ImageProperties, ImagePath, false);
+				}
+			}
+		}
+	}
+}
+
+void FCreditsCompiler::Compile(const TArray<FCreditsSection>& Sections, FCreditsCompiledCredits& Out)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsCompile);
+	LLM_SCOPE_BYTAG(Credits);
+
+	Out.Reset();
+
+	int32 NumLines = 0;
+	int32 NumChars = 0;
+	for (const FCreditsSection& Section : Sections)
+	{
+		NumLines += 1 + Section.Roles.Num();
+		NumChars += Section.SectionProperties.Title.TextProperties.Title.Len();
+		for (const FCreditsRole& Role : Section.Roles)
+		{
+			NumLines += Role.PlayedByNames.Num();
+			NumChars += Role.RoleProperties.Role.TextProperties.Title.Len();
+			for (const FCreditsNameTextObject& Name : Role.PlayedByNames)
+			{
+				NumChars += Name.TextProperties.Title.Len();
+			}
+		}
+	}
+	Out.Lines.Reserve(NumLines, NumChars);
+
+	for (const FCreditsSection& Section : Sections)
+	{
+		CompileSection(Section, Out);
+	}
+
+	Out.Lines.UpdateOffsets();
+}
+
+void FCreditsCompiler::CompileSection(const FCreditsSection& Section, FCreditsCompiledCredits& Out)
+{
+	const FCreditsSectionDefaults& SectionProperties = Section.SectionProperties;
+	const FCreditsTextObject& Title = SectionProperties.Title;
+
+	Out.Lines.BeginSection(SectionProperties.SectionPadding);
+
+	if (SectionProperties.TitlePosition == ECreditsStartingPosition::Top)
+	{
+		CompileTextObject(Out, ECreditsLineKind::SectionTitle, Title.TextProperties, Title.ImageProperties, Title.Padding, ECreditsLineFlags::None);
+	}
+
+	for (const FCreditsRole& Role : Section.Roles)
+	{
+		const FCreditsRoleDefaults& RoleProperties = Role.RoleProperties;
+		const bool bSideRole = RoleProperties.DisplayRoleName && RoleProperties.RolePosition == ECreditsTextPosition::Side;
+
+		if (RoleProperties.DisplayRoleName)
+		{
+			const FCreditsTextObject& RoleText = RoleProperties.Role;
+			CompileTextObject(Out, ECreditsLineKind::Role, RoleText.TextProperties, RoleText.ImageProperties, RoleText.Padding, bSideRole ? ECreditsLineFlags::SideColumn : ECreditsLineFlags::None);
+		}
+
+		for (const FCreditsNameTextObject& Name : Role.PlayedByNames)
+		{
+			CompileTextObject(Out, ECreditsLineKind::Name, Name.TextProperties, Name.ImageProperties, Name.Padding, bSideRole ? ECreditsLineFlags::NameColumn : ECreditsLineFlags::None);
+		}
+	}
+
+	if (SectionProperties.TitlePosition == ECreditsStartingPosition::Bottom)
+	{
+		CompileTextObject(Out, ECreditsLineKind::SectionTitle, Title.TextProperties, Title.ImageProperties, Title.Padding, ECreditsLineFlags::None);
+	}
+}
+
+float FCreditsCompiler::EstimateTextHeight(const FCreditsLineStyle& Style)
+{
+	return Style.FontSize * CreditsEstimatedLineHeightScale;
+}
+
+float FCreditsCompiler::EstimateTextWidth(const FCreditsLineStyle& Style, int32 NumChars)
+{
+	return NumChars * Style.FontSize * CreditsEstimatedCharWidthScale;
+}
+
+float FCreditsCompiler::GetImageWidth(const FCreditsLineStyle& Style, const FVector2D& NativeSize)
+{
+	return Style.ImageSizeOverride ? Style.ImageSizeProperties.X : NativeSize.X;
+}
+
+float FCreditsCompiler::GetImageHeight(const FCreditsLineStyle& Style, const FVector2D& NativeSize)
+{
+	return Style.ImageSizeOverride ? Style.ImageSizeProperties.Y : NativeSize.Y;
+}
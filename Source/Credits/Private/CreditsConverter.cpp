@@ -0,0 +1,233 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsConverter.h"
+#include "Engine/DataTable.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsStats.h"
+#include "CreditsStyleResolver.h"
+
+namespace CreditsConverter
+{
+	/** Names converted by each worker task. */
+	static const int32 NameBatchSize = 512;
+
+	/** Simple struct for a section to convert. */
+	struct FSectionJob
+	{
+		const FCreditsSectionSimple* Simple;
+		FName Key;
+		FCreditsSection* Out;
+	};
+
+	/** Simple struct for a role to convert, Out is uninitialized memory. */
+	struct FRoleJob
+	{
+		const FCreditsRoleStructSimple* Simple;
+		FName Section;
+		FName Key;
+		FCreditsRole* Out;
+		int32 Scope;
+	};
+
+	/** Simple struct for a run of names to convert, Out is uninitialized memory. */
+	struct FNameJob
+	{
+		const FCreditsTextObjectSimple* Simple;
+		int32 Num;
+		int32 Scope;
+		FCreditsNameTextObject* Out;
+	};
+
+	/** Copies the text and, unless the styled object already brings an image, the image of a simple text object. */
+	static void ApplySimpleText(const FCreditsTextObjectSimple& Simple, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties)
+	{
+		TextProperties.Title = Simple.Text;
+		if (!ImageProperties.HasImage())
+		{
+			ImageProperties = Simple.ImageProperties;
+		}
+	}
+
+	/** Splits Num names into jobs of at most NameBatchSize. */
+	static void AddNameJobs(TArray<FNameJob>& Jobs, const FCreditsTextObjectSimple* Simple, int32 Num, int32 Scope, FCreditsNameTextObject* Out)
+	{
+		for (int32 Start = 0; Start < Num; Start += NameBatchSize)
+		{
+			Jobs.Add(FNameJob{ Simple + Start, FMath::Min(NameBatchSize, Num - Start), Scope, Out + Start });
+		}
+	}
+
+	static void ConvertNameJobs(const TArray<FNameJob>& Jobs, const FCreditsStyleResolver& Resolver, EParallelForFlags Flags)
+	{
+		ParallelFor(Jobs.Num(), [&Jobs, &Resolver](int32 JobIndex)
+		{
+			const FNameJob& Job = Jobs[JobIndex];
+			const FCreditsStyleScope& Scope = Resolver.GetScope(Job.Scope);
+			for (int32 Index = 0; Index < Job.Num; ++Index)
+			{
+				const FCreditsTextObjectSimple& Simple = Job.Simple[Index];
+				FCreditsNameTextObject* Name = new (Job.Out + Index) FCreditsNameTextObject(Resolver.ResolveName(Scope, Simple.Text));
+				ApplySimpleText(Simple, Name->TextProperties, Name->ImageProperties);
+			}
+		}, Flags);
+	}
+
+	static void ConvertRoleJobs(TArray<FRoleJob>& Jobs, FCreditsStyleResolver& Resolver, EParallelForFlags Flags)
+	{
+		ParallelFor(Jobs.Num(), [&Jobs](int32 JobIndex)
+		{
+			FRoleJob& Job = Jobs[JobIndex];
+			Job.Key = FName(*Job.Simple->Role.Text);
+		}, Flags);
+
+		// the scopes are memoized, so they are resolved here before the workers read them.
+		for (FRoleJob& Job : Jobs)
+		{
+			Job.Scope = Resolver.ResolveScope(Job.Section, Job.Key);
+		}
+
+		ParallelFor(Jobs.Num(), [&Jobs, &Resolver](int32 JobIndex)
+		{
+			FRoleJob& Job = Jobs[JobIndex];
+			const FCreditsRoleStructSimple& Simple = *Job.Simple;
+			FCreditsRole* Role = new (Job.Out) FCreditsRole(*Resolver.GetScope(Job.Scope).Role, TArray<FCreditsNameTextObject>());
+
+			// display role name has no meaning on an override, the simple role decides.
+			Role->RoleProperties.DisplayRoleName = Simple.DisplayRoleName;
+			ApplySimpleText(Simple.Role, Role->RoleProperties.Role.TextProperties, Role->RoleProperties.Role.ImageProperties);
+			Role->PlayedByNames.AddUninitialized(Simple.PlayedBy.Num());
+		}, Flags);
+
+		// every role now owns its name storage, fill it in batches so one huge role still spreads across workers.
+		TArray<FNameJob> NameJobs;
+		for (const FRoleJob& Job : Jobs)
+		{
+			AddNameJobs(NameJobs, Job.Simple->PlayedBy.GetData(), Job.Simple->PlayedBy.Num(), Job.Scope, Job.Out->PlayedByNames.GetData());
+		}
+		ConvertNameJobs(NameJobs, Resolver, Flags);
+	}
+
+	static void ConvertSectionJobs(const TArray<FSectionJob>& Jobs, FCreditsStyleResolver& Resolver, EParallelForFlags Flags)
+	{
+		TArray<FRoleJob> RoleJobs;
+		for (const FSectionJob& Job : Jobs)
+		{
+			const TArray<FCreditsRoleStructSimple>& SimpleRoles = Job.Simple->Roles;
+			Job.Out->Roles.Reset(SimpleRoles.Num());
+			Job.Out->Roles.AddUninitialized(SimpleRoles.Num());
+			for (int32 RoleIndex = 0; RoleIndex < SimpleRoles.Num(); ++RoleIndex)
+			{
+				RoleJobs.Add(FRoleJob{ &SimpleRoles[RoleIndex], Job.Key, NAME_None, &Job.Out->Roles[RoleIndex], INDEX_NONE });
+			}
+		}
+
+		ParallelFor(Jobs.Num(), [&Jobs, &Resolver](int32 JobIndex)
+		{
+			const FSectionJob& Job = Jobs[JobIndex];
+			FCreditsSectionDefaults& SectionProperties = Job.Out->SectionProperties;
+			SectionProperties = Resolver.ResolveSection(Job.Key);
+			ApplySimpleText(Job.Simple->Title, SectionProperties.Title.TextProperties, SectionProperties.Title.ImageProperties);
+		}, Flags);
+
+		ConvertRoleJobs(RoleJobs, Resolver, Flags);
+	}
+}
+
+void FCreditsConverter::ConvertTitle(const FCreditsTextObjectSimple& Simple, FCreditsTextObject& Out)
+{
+	Out = FCreditsSectionDefaults().Title;
+	CreditsConverter::ApplySimpleText(Simple, Out.TextProperties, Out.ImageProperties);
+}
+
+void FCreditsConverter::ConvertRoleText(const FCreditsTextObjectSimple& Simple, FCreditsTextObject& Out)
+{
+	Out = FCreditsRoleDefaults().Role;
+	CreditsConverter::ApplySimpleText(Simple, Out.TextProperties, Out.ImageProperties);
+}
+
+void FCreditsConverter::ConvertNames(const TArray<FCreditsTextObjectSimple>& Simple, const FCreditsOverrideIndex* Overrides, const FName& Section, const FName& Role, TArray<FCreditsNameTextObject>& Out, EParallelForFlags Flags)
+{
+	FCreditsStyleResolver Resolver(Overrides);
+	const int32 Scope = Resolver.ResolveScope(Section, Role);
+
+	Out.Reset(Simple.Num());
+	Out.AddUninitialized(Simple.Num());
+
+	TArray<CreditsConverter::FNameJob> Jobs;
+	CreditsConverter::AddNameJobs(Jobs, Simple.GetData(), Simple.Num(), Scope, Out.GetData());
+	CreditsConverter::ConvertNameJobs(Jobs, Resolver, Flags);
+}
+
+void FCreditsConverter::ConvertRoles(const TArray<FCreditsRoleStructSimple>& Simple, const FCreditsOverrideIndex* Overrides, const FName& Section, TArray<FCreditsRole>& Out, EParallelForFlags Flags)
+{
+	FCreditsStyleResolver Resolver(Overrides);
+
+	Out.Reset(Simple.Num());
+	Out.AddUninitialized(Simple.Num());
+
+	TArray<CreditsConverter::FRoleJob> Jobs;
+	Jobs.Reserve(Simple.Num());
+	for (int32 Index = 0; Index < Simple.Num(); ++Index)
+	{
+		Jobs.Add(CreditsConverter::FRoleJob{ &Simple[Index], Section, NAME_None, &Out[Index], INDEX_NONE });
+	}
+	CreditsConverter::ConvertRoleJobs(Jobs, Resolver, Flags);
+}
+
+void FCreditsConverter::ConvertSection(const FCreditsSectionSimple& Simple, const FCreditsOverrideIndex* Overrides, const FName& SectionKey, FCreditsSection& Out, EParallelForFlags Flags)
+{
+	FCreditsStyleResolver Resolver(Overrides);
+
+	TArray<CreditsConverter::FSectionJob> Jobs;
+	Jobs.Add(CreditsConverter::FSectionJob{ &Simple, SectionKey, &Out });
+	CreditsConverter::ConvertSectionJobs(Jobs, Resolver, Flags);
+}
+
+void FCreditsConverter::ConvertSections(const TArray<FCreditsSectionSimple>& Simple, const FCreditsOverrideIndex* Overrides, TArray<FCreditsSection>& Out, EParallelForFlags Flags)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsConvert);
+	LLM_SCOPE_BYTAG(Credits);
+
+	FCreditsStyleResolver Resolver(Overrides);
+
+	Out.Reset();
+	Out.SetNum(Simple.Num());
+
+	TArray<CreditsConverter::FSectionJob> Jobs;
+	Jobs.Reserve(Simple.Num());
+	for (int32 Index = 0; Index < Simple.Num(); ++Index)
+	{
+		Jobs.Add(CreditsConverter::FSectionJob{ &Simple[Index], FName(*Simple[Index].Title.Text), &Out[Index] });
+	}
+	CreditsConverter::ConvertSectionJobs(Jobs, Resolver, Flags);
+}
+
+void FCreditsConverter::ConvertDataTable(const UDataTable* Sections, const FCreditsOverrideIndex* Overrides, TArray<FCreditsSection>& Out, EParallelForFlags Flags)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsConvert);
+	LLM_SCOPE_BYTAG(Credits);
+
+	Out.Reset();
+	if (Sections == nullptr)
+	{
+		return;
+	}
+	if (!Sections->GetRowStruct() || !Sections->GetRowStruct()->IsChildOf(FCreditsSectionSimple::StaticStruct()))
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsConverter: %s does not hold FCreditsSectionSimple rows"), *Sections->GetName());
+		return;
+	}
+
+	FCreditsStyleResolver Resolver(Overrides);
+	const TMap<FName, uint8*>& RowMap = Sections->GetRowMap();
+	Out.SetNum(RowMap.Num());
+
+	TArray<CreditsConverter::FSectionJob> Jobs;
+	Jobs.Reserve(RowMap.Num());
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		Jobs.Add(CreditsConverter::FSectionJob{ reinterpret_cast<const FCreditsSectionSimple*>(Row.Value), Row.Key, &Out[Jobs.Num()] });
+	}
+	CreditsConverter::ConvertSectionJobs(Jobs, Resolver, Flags);
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsCurveTable.h"
+#include "Algo/BinarySearch.h"
+#include "Curves/CurveFloat.h"
+#include "CreditsManager.h"
+
+const float FCreditsCurveTable::DefaultStepSeconds = 1.0f / 120.0f;
+
+/** Returns true when Extrapolation does more than hold the value of the end key. */
+static bool IsCreditsCurveExtrapolated(ERichCurveExtrapolation Extrapolation)
+{
+	return Extrapolation != RCCE_Constant && Extrapolation != RCCE_None;
+}
+
+FCreditsCurveTable::FCreditsCurveTable()
+	: StepSeconds(DefaultStepSeconds)
+	, InvStepSeconds(1.0f / DefaultStepSeconds)
+	, StartTime(0.0f)
+	, CycleStartTime(0.0f)
+	, ZeroIntegral(0.0)
+	, PreSlope(0.0f)
+	, PostSlope(0.0f)
+	, PostExtrapolation(RCCE_Constant)
+	, bEvalPreExtrapolation(false)
+	, bEvalPostExtrapolation(false)
+{
+	Values.Add(0.0f);
+	Integrals.Add(0.0);
+}
+
+void FCreditsCurveTable::Bake(const UCurveFloat* Curve, float DefaultValue, float InStepSeconds)
+{
+	float MinTime = 0.0f;
+	float MaxTime = 0.0f;
+	if (Curve)
+	{
+		Curve->GetTimeRange(MinTime, MaxTime);
+	}
+
+	// a curve too long for the step is baked at a coarser one, a constant is a single sample.
+	StartTime = FMath::Min(0.0f, MinTime);
+	const float EndTime = FMath::Max(0.0f, MaxTime);
+	const float Duration = EndTime - StartTime;
+	StepSeconds = FMath::Max(InStepSeconds, Duration / (MaxSamples - 1), KINDA_SMALL_NUMBER);
+	const int32 NumSamples = Curve ? FMath::CeilToInt(Duration / StepSeconds) + 1 : 1;
+
+	// the last sample lands on the last key, so a cycle of the extrapolation starts where the samples end.
+	if (NumSamples > 1)
+	{
+		StepSeconds = Duration / (NumSamples - 1);
+	}
+	InvStepSeconds = 1.0f / StepSeconds;
+
+	Values.SetNumUninitialized(NumSamples);
+	for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+	{
+		Values[Sample] = Curve ? Curve->GetFloatValue(StartTime + Sample * StepSeconds) : DefaultValue;
+	}
+
+	// the samples are joined by lines, so each step adds a trapezoid and the integral is exact for the table.
+	Integrals.SetNumUninitialized(NumSamples);
+	Integrals[0] = 0.0;
+	for (int32 Sample = 1; Sample < NumSamples; ++Sample)
+	{
+		Integrals[Sample] = Integrals[Sample - 1] + 0.5 * (Values[Sample - 1] + Values[Sample]) * StepSeconds;
+	}
+	ZeroIntegral = IntegrateSamples(0.0);
+
+	const ERichCurveExtrapolation PreExtrapolation = Curve ? Curve->FloatCurve.PreInfinityExtrap.GetValue() : RCCE_Constant;
+	PostExtrapolation = Curve ? Curve->FloatCurve.PostInfinityExtrap.GetValue() : RCCE_Constant;
+	bEvalPreExtrapolation = IsCreditsCurveExtrapolated(PreExtrapolation);
+	bEvalPostExtrapolation = IsCreditsCurveExtrapolated(PostExtrapolation);
+	CycleStartTime = MinTime;
+	if (bEvalPreExtrapolation || bEvalPostExtrapolation)
+	{
+		SourceCurve = Curve->FloatCurve;
+	}
+	else
+	{
+		SourceCurve.Reset();
+	}
+
+	// a linear extrapolation goes on with the slope the curve leaves its end key at, a second after it is on the line.
+	PreSlope = PreExtrapolation == RCCE_Linear ? Values[0] - SourceCurve.Eval(StartTime - 1.0f) : 0.0f;
+	PostSlope = PostExtrapolation == RCCE_Linear ? SourceCurve.Eval(EndTime + 1.0f) - Values.Last() : 0.0f;
+}
+
+float FCreditsCurveTable::EvaluateIntegral(float Time) const
+{
+	const double EndTime = GetEndTime();
+	if (Time <= StartTime)
+	{
+		const double Delta = Time - StartTime;
+		return (float)((Values[0] + 0.5 * PreSlope * Delta) * Delta - ZeroIntegral);
+	}
+	if (Time >= EndTime)
+	{
+		return (float)(Integrals.Last() + IntegratePostExtrapolation(Time - EndTime) - ZeroIntegral);
+	}
+	return (float)(IntegrateSamples(Time) - ZeroIntegral);
+}
+
+float FCreditsCurveTable::FindTimeAtIntegral(float Integral) const
+{
+	const double Target = Integral + ZeroIntegral;
+	if (Target <= 0.0)
+	{
+		return StartTime + (Values[0] > 0.0f ? (float)(Target / Values[0]) : 0.0f);
+	}
+	if (Target >= Integrals.Last())
+	{
+		const double Remaining = Target - Integrals.Last();
+		if (!bEvalPostExtrapolation)
+		{
+			return GetEndTime() + (Values.Last() > 0.0f ? (float)(Remaining / Values.Last()) : 0.0f);
+		}
+
+		// the extrapolated area only grows with time, so it is bracketed by doubling and then bisected.
+		double Low = 0.0;
+		double High = FMath::Max((double)StepSeconds, (double)(GetEndTime() - CycleStartTime));
+		for (int32 Iteration = 0; Iteration < 64 && IntegratePostExtrapolation(High) < Remaining; ++Iteration)
+		{
+			Low = High;
+			High *= 2.0;
+		}
+		for (int32 Iteration = 0; Iteration < 48; ++Iteration)
+		{
+			const double Middle = 0.5 * (Low + High);
+			(IntegratePostExtrapolation(Middle) < Remaining ? Low : High) = Middle;
+		}
+		return GetEndTime() + (float)High;
+	}
+
+	// the sample before Integral, then the time into its step solving the area under the line for it.
+	const int32 Index = FMath::Max(0, Algo::UpperBound(Integrals, Target) - 1);
+	const double Remaining = Target - Integrals[Index];
+	const double Slope = 0.5 * (Values[Index + 1] - Values[Index]) * InvStepSeconds;
+	const double Speed = Values[Index];
+	const double Root = FMath::Sqrt(FMath::Max(0.0, Speed * Speed + 4.0 * Slope * Remaining));
+	const double Step = Speed + Root > 0.0 ? 2.0 * Remaining / (Speed + Root) : 0.0;
+	return StartTime + Index * StepSeconds + (float)FMath::Min(Step, (double)StepSeconds);
+}
+
+double FCreditsCurveTable::IntegrateSamples(double Time) const
+{
+	const double Position = FMath::Max(0.0, (Time - StartTime) * InvStepSeconds);
+	const int32 Index = (int32)Position;
+	if (Index >= Values.Num() - 1)
+	{
+		return Integrals.Last();
+	}
+
+	// the area under the line from the sample to Time.
+	const double Alpha = Position - Index;
+	const double Value = FMath::Lerp((double)Values[Index], (double)Values[Index + 1], Alpha);
+	return Integrals[Index] + 0.5 * (Values[Index] + Value) * Alpha * StepSeconds;
+}
+
+double FCreditsCurveTable::IntegratePostExtrapolation(double Delta) const
+{
+	const double EndTime = GetEndTime();
+	const double Period = EndTime - CycleStartTime;
+	switch (PostExtrapolation)
+	{
+	case RCCE_Linear:
+		return (Values.Last() + 0.5 * PostSlope * Delta) * Delta;
+
+	case RCCE_Cycle:
+	case RCCE_CycleWithOffset:
+	case RCCE_Oscillate:
+		if (Period > 0.0)
+		{
+			// whole cycles repeat the area of the keys, oscillating ones run it backwards every other cycle.
+			const double CycleStartIntegral = IntegrateSamples(CycleStartTime);
+			const double CycleArea = Integrals.Last() - CycleStartIntegral;
+			const double NumCycles = FMath::FloorToDouble(Delta / Period);
+			const double Remainder = Delta - NumCycles * Period;
+			const bool bBackwards = PostExtrapolation == RCCE_Oscillate && FMath::Fmod(NumCycles, 2.0) == 0.0;
+			double Area = NumCycles * CycleArea;
+			Area += bBackwards ? Integrals.Last() - IntegrateSamples(EndTime - Remainder) : IntegrateSamples(CycleStartTime + Remainder) - CycleStartIntegral;
+
+			// each cycle with offset is raised once more by the change of value over the keys.
+			if (PostExtrapolation == RCCE_CycleWithOffset)
+			{
+				const double Offset = Values.Last() - SourceCurve.Eval(CycleStartTime);
+				Area += Offset * (Period * NumCycles * (NumCycles + 1.0) * 0.5 + (NumCycles + 1.0) * Remainder);
+			}
+			return Area;
+		}
+		return Values.Last() * Delta;
+
+	default:
+		return Values.Last() * Delta;
+	}
+}
+
+void FCreditsRollCurves::Bake(const FCreditsGeneralSettings& Settings, float DefaultSpeed)
+{
+	Speed.Bake(Settings.SpeedCurve, DefaultSpeed);
+	Opacity.Bake(Settings.OpacityCurve, 1.0f);
+	Volume.Bake(Settings.VolumeCurve, 1.0f);
+}
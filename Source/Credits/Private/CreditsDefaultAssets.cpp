@@ -0,0 +1,78 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsDefaultAssets.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/Font.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "Sound/SoundWave.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+#include "CreditsModule.h"
+
+// default asset locations.
+static const TCHAR* CreditsDefaultFontPath = TEXT("/Engine/EngineFonts/Roboto.Roboto");
+static const TCHAR* CreditsSpeedCurvePath = TEXT("/Game/Base/Blueprints/FloatCurves/CreditsSpeedCurve.CreditsSpeedCurve");
+static const TCHAR* CreditsOpacityCurvePath = TEXT("/Game/Base/Blueprints/FloatCurves/CreditsOpacityCurve.CreditsOpacityCurve");
+static const TCHAR* CreditsVolumeCurvePath = TEXT("/Game/Base/Blueprints/FloatCurves/MusicVolumeCurve.MusicVolumeCurve");
+
+FCreditsDefaultAssets FCreditsDefaultAssets::Instance;
+std::atomic<bool> FCreditsDefaultAssets::bResolved(false);
+
+/** Keeps the resolved defaults from being garbage collected while the module is loaded. */
+static TArray<TStrongObjectPtr<UObject>> CreditsDefaultAssetPins;
+
+template<typename T>
+static T* LoadCreditsDefaultAsset(const TCHAR* Path)
+{
+	T* Asset = LoadObject<T>(nullptr, Path, nullptr, LOAD_NoWarn, nullptr);
+	if (Asset)
+	{
+		CreditsDefaultAssetPins.Emplace(Asset);
+	}
+	else
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsDefaultAssets: unable to load default asset %s"), Path);
+	}
+	return Asset;
+}
+
+void FCreditsDefaultAssets::Resolve()
+{
+	check(IsInGameThread());
+
+	if (bResolved.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// the default font material, image and sound wave have no asset, they stay null.
+	Instance.Font = LoadCreditsDefaultAsset<UFont>(CreditsDefaultFontPath);
+	Instance.SpeedCurve = LoadCreditsDefaultAsset<UCurveFloat>(CreditsSpeedCurvePath);
+	Instance.OpacityCurve = LoadCreditsDefaultAsset<UCurveFloat>(CreditsOpacityCurvePath);
+	Instance.VolumeCurve = LoadCreditsDefaultAsset<UCurveFloat>(CreditsVolumeCurvePath);
+
+	// publishes the defaults to the threads reading them without a lock.
+	bResolved.store(true, std::memory_order_release);
+}
+
+void FCreditsDefaultAssets::Release()
+{
+	bResolved.store(false, std::memory_order_release);
+	CreditsDefaultAssetPins.Empty();
+	Instance = FCreditsDefaultAssets();
+}
+
+const FCreditsDefaultAssets& FCreditsDefaultAssets::ResolveOnFirstUse()
+{
+	// structs built off the game thread, or before UObjects are up, get null defaults rather than loading.
+	static const FCreditsDefaultAssets Unresolved;
+	if (!IsInGameThread() || !UObjectInitialized())
+	{
+		return Unresolved;
+	}
+
+	// resolved once even during the initial load, an asset not mounted yet stays null rather than being looked up again.
+	Resolve();
+	return Instance;
+}
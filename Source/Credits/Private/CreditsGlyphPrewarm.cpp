@@ -0,0 +1,107 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsGlyphPrewarm.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontCache.h"
+#include "Rendering/SlateRenderer.h"
+#include "CreditsCompiler.h"
+#include "CreditsModule.h"
+
+/** Simple struct for the characters shown in one font, size and font material. */
+struct FCreditsFontGlyphs
+{
+	/** reference to the font. */
+	FSlateFontInfo FontInfo;
+
+	/** reference to the characters shown in the font. */
+	TSet<TCHAR> Chars;
+};
+
+bool FCreditsGlyphPrewarm::Prewarm(const FCreditsCompiledCredits& Credits, float FontScale, FCreditsGlyphPrewarmStats* OutStats)
+{
+	return PrewarmLines(Credits, 0, Credits.Lines.Num(), FontScale, OutStats);
+}
+
+bool FCreditsGlyphPrewarm::PrewarmLines(const FCreditsCompiledCredits& Credits, int32 FirstLine, int32 EndLine, float FontScale, FCreditsGlyphPrewarmStats* OutStats)
+{
+	if (!IsInGameThread() || !FSlateApplication::IsInitialized() || !FSlateApplication::Get().GetRenderer())
+	{
+		return false;
+	}
+
+	// styles also differ by color and padding, which the font cache does not care about.
+	const FCreditsStyleTable& Styles = Credits.Styles;
+	TArray<FCreditsFontGlyphs> Fonts;
+	TArray<int32> StyleFonts;
+	StyleFonts.SetNum(Styles.Num());
+	for (int32 StyleIndex = 0; StyleIndex < Styles.Num(); ++StyleIndex)
+	{
+		const FSlateFontInfo& FontInfo = Styles.GetFontInfo(StyleIndex);
+		StyleFonts[StyleIndex] = Fonts.IndexOfByPredicate([&FontInfo](const FCreditsFontGlyphs& Font)
+		{
+			return Font.FontInfo.IsIdenticalTo(FontInfo);
+		});
+		if (StyleFonts[StyleIndex] == INDEX_NONE)
+		{
+			StyleFonts[StyleIndex] = Fonts.Add(FCreditsFontGlyphs{ FontInfo });
+		}
+	}
+
+	const FCreditsLineTable& Lines = Credits.Lines;
+	for (int32 Line = FMath::Max(0, FirstLine); Line < FMath::Min(EndLine, Lines.Num()); ++Line)
+	{
+		if (Lines.Kinds[Line] == ECreditsLineKind::Image)
+		{
+			continue;
+		}
+
+		TSet<TCHAR>& Chars = Fonts[StyleFonts[Lines.StyleIndices[Line]]].Chars;
+		for (const TCHAR Char : Lines.GetText(Line))
+		{
+			Chars.Add(Char);
+		}
+	}
+
+	const TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+	const int32 NumAtlasPages = FontCache->GetNumAtlasPages();
+
+	int32 NumGlyphs = 0;
+	for (const FCreditsFontGlyphs& Font : Fonts)
+	{
+		if (Font.Chars.Num() == 0)
+		{
+			continue;
+		}
+
+		// widgets draw shaped glyphs, the painter draws characters, both are cached.
+		FString Text;
+		Text.Reserve(Font.Chars.Num());
+		FCharacterList& CharacterList = FontCache->GetCharacterList(Font.FontInfo, FontScale);
+		for (const TCHAR Char : Font.Chars)
+		{
+			Text.AppendChar(Char);
+			CharacterList.GetCharacter(Char, EFontFallback::FF_Max);
+		}
+
+		const FShapedGlyphSequenceRef Sequence = FontCache->ShapeBidirectionalText(Text, Font.FontInfo, FontScale, TextBiDi::ETextDirection::LeftToRight, ETextShapingMethod::Auto);
+		for (const FShapedGlyphEntry& Glyph : Sequence->GetGlyphsToRender())
+		{
+			if (Glyph.bIsVisible)
+			{
+				FontCache->GetShapedGlyphFontAtlasData(Glyph, Font.FontInfo.OutlineSettings);
+				++NumGlyphs;
+			}
+		}
+	}
+
+	const int32 NumNewAtlasPages = FontCache->GetNumAtlasPages() - NumAtlasPages;
+	UE_LOG(ClosingCreditsLog, Log, TEXT("FCreditsGlyphPrewarm: rasterized %d glyphs of %d fonts into %d new atlas pages"), NumGlyphs, Fonts.Num(), NumNewAtlasPages);
+
+	if (OutStats)
+	{
+		OutStats->NumFonts = Fonts.Num();
+		OutStats->NumGlyphs = NumGlyphs;
+		OutStats->NumNewAtlasPages = NumNewAtlasPages;
+	}
+	return true;
+}
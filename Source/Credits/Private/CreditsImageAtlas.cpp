@@ -0,0 +1,324 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsImageAtlas.h"
+#include "CanvasTypes.h"
+#include "ContentStreaming.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Misc/App.h"
+#include "UObject/Package.h"
+#include "CreditsCompiler.h"
+#include "CreditsModule.h"
+#include "CreditsStats.h"
+
+FCreditsAtlasEntry::FCreditsAtlasEntry()
+	: Page(INDEX_NONE)
+	, UVMin(FVector2D::ZeroVector)
+	, UVMax(FVector2D::ZeroVector)
+{
+}
+
+/** Points Brush at the region of Page between UVMin and UVMax. */
+static void SetAtlasBrush(FSlateBrush& Brush, UTexture* Page, const FVector2D& UVMin, const FVector2D& UVMax)
+{
+	Brush.SetResourceObject(Page);
+	Brush.SetUVRegion(FBox2D(UVMin, UVMax));
+	Brush.DrawAs = ESlateBrushDrawType::Image;
+}
+
+int32 FCreditsImageAtlas::Pack(const TArray<FIntPoint>& Sizes, int32 PageSize, TArray<int32>& OutPages, TArray<FIntPoint>& OutPositions)
+{
+	OutPages.Init(INDEX_NONE, Sizes.Num());
+	OutPositions.Init(FIntPoint::ZeroValue, Sizes.Num());
+
+	TArray<int32> Order;
+	Order.Reserve(Sizes.Num());
+	for (int32 Index = 0; Index < Sizes.Num(); ++Index)
+	{
+		Order.Add(Index);
+	}
+	Order.Sort([&Sizes](int32 A, int32 B)
+	{
+		return Sizes[A].Y != Sizes[B].Y ? Sizes[A].Y > Sizes[B].Y : Sizes[A].X > Sizes[B].X;
+	});
+
+	int32 NumPages = 0;
+	int32 ShelfX = 0;
+	int32 ShelfY = 0;
+	int32 ShelfHeight = 0;
+	for (int32 Index : Order)
+	{
+		const FIntPoint PaddedSize = Sizes[Index] + FIntPoint(Padding, Padding);
+		if (PaddedSize.X > PageSize || PaddedSize.Y > PageSize)
+		{
+			continue;
+		}
+
+		// a full shelf opens the next one below it, a full page opens the next page.
+		if (NumPages == 0 || ShelfX + PaddedSize.X > PageSize)
+		{
+			ShelfY += ShelfHeight;
+			ShelfX = 0;
+			ShelfHeight = 0;
+		}
+		if (NumPages == 0 || ShelfY + PaddedSize.Y > PageSize)
+		{
+			++NumPages;
+			ShelfX = 0;
+			ShelfY = 0;
+			ShelfHeight = 0;
+		}
+
+		OutPages[Index] = NumPages - 1;
+		OutPositions[Index] = FIntPoint(ShelfX, ShelfY);
+		ShelfX += PaddedSize.X;
+		ShelfHeight = FMath::Max(ShelfHeight, PaddedSize.Y);
+	}
+	return NumPages;
+}
+
+int32 FCreditsImageAtlas::Build(FCreditsCompiledCredits& Credits, int32 PageSize, int32 MaxImageSize)
+{
+	LLM_SCOPE_BYTAG(Credits);
+
+	check(IsInGameThread());
+
+	TArray<int32> ImageIndices;
+	TArray<FIntPoint> Sizes;
+	for (int32 ImageIndex = 0; ImageIndex < Credits.Images.Num(); ++ImageIndex)
+	{
+		UTexture2D* Texture = Credits.Images[ImageIndex];
+		if (Texture == nullptr || Credits.SoftImages[ImageIndex])
+		{
+			continue;
+		}
+		const FIntPoint Size(Texture->GetSizeX(), Texture->GetSizeY());
+		if (Size.X > 0 && Size.Y > 0 && Size.X <= MaxImageSize && Size.Y <= MaxImageSize)
+		{
+			ImageIndices.Add(ImageIndex);
+			Sizes.Add(Size);
+		}
+	}
+
+	// a single image gains nothing from an atlas.
+	if (ImageIndices.Num() < 2)
+	{
+		return 0;
+	}
+
+	TArray<int32> Pages;
+	TArray<FIntPoint> Positions;
+	const int32 NumPages = Pack(Sizes, PageSize, Pages, Positions);
+
+	// the full mip chain of every packed image has to be resident, the atlas copy is taken once, so all of them
+	// are requested before a single wait.
+	IRenderAssetStreamingManager& StreamingManager = IStreamingManager::Get().GetRenderAssetStreamingManager();
+	for (int32 Index = 0; Index < ImageIndices.Num(); ++Index)
+	{
+		if (Pages[Index] != INDEX_NONE)
+		{
+			UTexture2D* Texture = Credits.Images[ImageIndices[Index]];
+			Texture->SetForceMipLevelsToBeResident(30.0f);
+			StreamingManager.UpdateIndividualRenderAsset(Texture);
+		}
+	}
+	StreamingManager.BlockTillAllRequestsFinished();
+
+	int32 NumAtlased = 0;
+	for (int32 PageIndex = 0; PageIndex < NumPages; ++PageIndex)
+	{
+		UTextureRenderTarget2D* Page = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+		Page->RenderTargetFormat = RTF_RGBA8;
+		Page->ClearColor = FLinearColor::Transparent;
+		Page->bAutoGenerateMips = false;
+		Page->InitAutoFormat(PageSize, PageSize);
+		Page->UpdateResourceImmediate(true);
+		Credits.AtlasPages.Add(Page);
+
+		FCanvas Canvas(Page->GameThread_GetRenderTargetResource(), nullptr, FGameTime::GetTimeSinceAppStart(), GMaxRHIFeatureLevel);
+		for (int32 Index = 0; Index < ImageIndices.Num(); ++Index)
+		{
+			if (Pages[Index] != PageIndex)
+			{
+				continue;
+			}
+
+			UTexture2D* Texture = Credits.Images[ImageIndices[Index]];
+			Canvas.DrawTile(Positions[Index].X, Positions[Index].Y, Sizes[Index].X, Sizes[Index].Y, 0.0f, 0.0f, 1.0f, 1.0f, FLinearColor::White, Texture->GetResource(), false);
+
+			const FVector2D UVMin = FVector2D(Positions[Index]) / PageSize;
+			const FVector2D UVMax = FVector2D(Positions[Index] + Sizes[Index]) / PageSize;
+			SetAtlasBrush(Credits.ImageBrushes[ImageIndices[Index]], Page, UVMin, UVMax);
+			++NumAtlased;
+		}
+		Canvas.Flush_GameThread();
+	}
+
+	// the copies are drawn, the images go back to streaming as they see fit.
+	for (int32 Index = 0; Index < ImageIndices.Num(); ++Index)
+	{
+		if (Pages[Index] != INDEX_NONE)
+		{
+			Credits.Images[ImageIndices[Index]]->SetForceMipLevelsToBeResident(0.0f);
+		}
+	}
+
+	UE_LOG(ClosingCreditsLog, Log, TEXT("FCreditsImageAtlas: packed %d images into %d pages"), NumAtlased, NumPages);
+	return NumAtlased;
+}
+
+int32 FCreditsImageAtlas::Apply(FCreditsCompiledCredits& Credits, const UCreditsImageAtlasAsset* Atlas)
+{
+	if (Atlas == nullptr)
+	{
+		return 0;
+	}
+
+	int32 NumAtlased = 0;
+	for (int32 ImageIndex = 0; ImageIndex < Credits.Images.Num(); ++ImageIndex)
+	{
+		const FCreditsAtlasEntry* Entry = Atlas->Entries.Find(Credits.ImagePaths[ImageIndex]);
+		if (Entry == nullptr || !Atlas->Pages.IsValidIndex(Entry->Page) || Atlas->Pages[Entry->Page] == nullptr)
+		{
+			continue;
+		}
+
+		UTexture2D* Page = Atlas->Pages[Entry->Page];
+		Credits.AtlasPages.AddUnique(Page);
+		SetAtlasBrush(Credits.ImageBrushes[ImageIndex], Page, Entry->UVMin, Entry->UVMax);
+
+		// the page holds the image now, the streamer leaves it alone.
+		Credits.SoftImages[ImageIndex] = false;
+		++NumAtlased;
+	}
+	return NumAtlased;
+}
+
+UCreditsImageAtlasAsset::UCreditsImageAtlasAsset(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, PageSize(2048)
+	, MaxImageSize(256)
+{
+}
+
+#if WITH_EDITOR
+/** Moves Page out of the atlas asset into the transient package under a unique name, for it to be collected. */
+static void RetirePage(UObject* Page)
+{
+	Page->ClearFlags(RF_Public | RF_Standalone);
+	Page->Rename(*MakeUniqueObjectName(GetTransientPackage(), Page->GetClass()).ToString(), GetTransientPackage(), REN_DontCreateRedirectors);
+}
+
+void UCreditsImageAtlasAsset::BuildAtlas()
+{
+	Modify();
+
+	// the old pages make way for the new ones taking their names.
+	for (UTexture2D* OldPage : Pages)
+	{
+		if (OldPage != nullptr)
+		{
+			RetirePage(OldPage);
+		}
+	}
+	Pages.Reset();
+	Entries.Reset();
+
+	TArray<UTexture2D*> Textures;
+	TArray<FIntPoint> Sizes;
+	for (const TSoftObjectPtr<UTexture2D>& SourceImage : SourceImages)
+	{
+		UTexture2D* Texture = SourceImage.LoadSynchronous();
+		if (Texture == nullptr)
+		{
+			continue;
+		}
+		if (Texture->Source.GetFormat() != TSF_BGRA8)
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("UCreditsImageAtlasAsset: %s is not BGRA8 and is left out of the atlas"), *Texture->GetName());
+			continue;
+		}
+		const FIntPoint Size(Texture->Source.GetSizeX(), Texture->Source.GetSizeY());
+		if (Size.X <= MaxImageSize && Size.Y <= MaxImageSize)
+		{
+			Textures.Add(Texture);
+			Sizes.Add(Size);
+		}
+	}
+
+	TArray<int32> PageIndices;
+	TArray<FIntPoint> Positions;
+	const int32 NumPages = FCreditsImageAtlas::Pack(Sizes, PageSize, PageIndices, Positions);
+
+	const int32 BytesPerPixel = 4;
+	TArray<TArray64<uint8>> PageData;
+	PageData.SetNum(NumPages);
+	for (TArray64<uint8>& Data : PageData)
+	{
+		Data.SetNumZeroed((int64)PageSize * PageSize * BytesPerPixel);
+	}
+
+	for (int32 Index = 0; Index < Textures.Num(); ++Index)
+	{
+		if (PageIndices[Index] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		TArray64<uint8> MipData;
+		if (!Textures[Index]->Source.GetMipData(MipData, 0))
+		{
+			continue;
+		}
+
+		// copies the image row by row into its place in the page.
+		const FIntPoint& Size = Sizes[Index];
+		const FIntPoint& Position = Positions[Index];
+		uint8* Page = PageData[PageIndices[Index]].GetData();
+		for (int32 Row = 0; Row < Size.Y; ++Row)
+		{
+			const int64 PageOffset = ((int64)(Position.Y + Row) * PageSize + Position.X) * BytesPerPixel;
+			FMemory::Memcpy(Page + PageOffset, MipData.GetData() + (int64)Row * Size.X * BytesPerPixel, Size.X * BytesPerPixel);
+		}
+
+		FCreditsAtlasEntry& Entry = Entries.Add(FSoftObjectPath(Textures[Index]));
+		Entry.Page = PageIndices[Index];
+		Entry.UVMin = FVector2D(Position) / PageSize;
+		Entry.UVMax = FVector2D(Position + Size) / PageSize;
+	}
+
+	for (int32 PageIndex = 0; PageIndex < NumPages; ++PageIndex)
+	{
+		// a page left out of Pages, by an undo or an older build, may still hold the name.
+		const FName PageName(*FString::Printf(TEXT("Page_%d"), PageIndex));
+		if (UObject* Stale = StaticFindObjectFast(UTexture2D::StaticClass(), this, PageName))
+		{
+			RetirePage(Stale);
+		}
+
+		UTexture2D* Page = NewObject<UTexture2D>(this, PageName, RF_Public);
+		Page->Source.Init(PageSize, PageSize, 1, 1, TSF_BGRA8, PageData[PageIndex].GetData());
+		Page->CompressionSettings = TC_EditorIcon;
+		Page->MipGenSettings = TMGS_NoMipmaps;
+		Page->LODGroup = TEXTUREGROUP_UI;
+		Page->SRGB = true;
+		Page->PostEditChange();
+		Pages.Add(Page);
+	}
+
+	UE_LOG(ClosingCreditsLog, Log, TEXT("UCreditsImageAtlasAsset: packed %d images into %d pages"), Entries.Num(), NumPages);
+}
+
+void UCreditsImageAtlasAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UCreditsImageAtlasAsset, SourceImages)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UCreditsImageAtlasAsset, PageSize)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UCreditsImageAtlasAsset, MaxImageSize))
+	{
+		BuildAtlas();
+	}
+}
+#endif
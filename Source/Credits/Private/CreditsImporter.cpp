@@ -0,0 +1,712 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsImporter.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "CreditsDefaultAssets.h"
+#include "CreditsModule.h"
+#include "CreditsStats.h"
+
+namespace CreditsImporter
+{
+	/** Simple struct for a range of the source text parsed by one task. */
+	struct FChunk
+	{
+		int32 Start;
+		int32 End;
+	};
+
+	/** Simple struct for the columns of a CSV export, INDEX_NONE when missing. */
+	struct FCsvColumns
+	{
+		int32 Section = INDEX_NONE;
+		int32 Role = INDEX_NONE;
+		int32 Name = INDEX_NONE;
+		int32 Image = INDEX_NONE;
+	};
+
+	/** Simple struct for a role gathered from the records, as record indices. */
+	struct FRolePlan
+	{
+		int32 Role = INDEX_NONE;
+		int32 Image = INDEX_NONE;
+		TArray<int32> Names;
+	};
+
+	/** Simple struct for a section gathered from the records, as record indices. */
+	struct FSectionPlan
+	{
+		int32 Title = INDEX_NONE;
+		int32 Image = INDEX_NONE;
+		TArray<FRolePlan> Roles;
+		TMap<FString, int32> RoleLookup;
+	};
+
+	/**
+	 * Parses one CSV row starting at Pos, leaving Pos at the start of the next row.
+	 * Unquoted fields are copied in one go, quoted ones may hold commas, newlines and doubled quotes.
+	 */
+	static bool ParseCsvRow(const TCHAR* Data, int32& Pos, int32 End, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+		if (Pos >= End)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			FString& Field = OutFields.AddDefaulted_GetRef();
+			if (Pos < End && Data[Pos] == TEXT('"'))
+			{
+				++Pos;
+				while (Pos < End)
+				{
+					const TCHAR Char = Data[Pos++];
+					if (Char != TEXT('"'))
+					{
+						Field.AppendChar(Char);
+					}
+					else if (Pos < End && Data[Pos] == TEXT('"'))
+					{
+						Field.AppendChar(Char);
+						++Pos;
+					}
+					else
+					{
+						break;
+					}
+				}
+				while (Pos < End && Data[Pos] != TEXT(',') && Data[Pos] != TEXT('\n'))
+				{
+					++Pos;
+				}
+			}
+			else
+			{
+				const int32 FieldStart = Pos;
+				while (Pos < End && Data[Pos] != TEXT(',') && Data[Pos] != TEXT('\n'))
+				{
+					++Pos;
+				}
+				const int32 FieldEnd = Pos > FieldStart && Data[Pos - 1] == TEXT('\r') ? Pos - 1 : Pos;
+				Field = FString(FieldEnd - FieldStart, Data + FieldStart);
+			}
+
+			if (Pos >= End || Data[Pos++] == TEXT('\n'))
+			{
+				return true;
+			}
+		}
+	}
+
+	/** Returns the field at Column, empty when the column is missing or the row is short. */
+	static FString TakeField(TArray<FString>& Fields, int32 Column)
+	{
+		return Fields.IsValidIndex(Column) ? MoveTemp(Fields[Column]) : FString();
+	}
+
+	/** Splits the CSV rows in [Start, End) into chunks of about ChunkSize characters, never inside a quoted field. */
+	static void SplitCsv(const TCHAR* Data, int32 Start, int32 End, TArray<FChunk>& OutChunks)
+	{
+		bool bInQuotes = false;
+		int32 ChunkStart = Start;
+		for (int32 Pos = Start; Pos < End; ++Pos)
+		{
+			if (Data[Pos] == TEXT('"'))
+			{
+				bInQuotes = !bInQuotes;
+			}
+			else if (Data[Pos] == TEXT('\n') && !bInQuotes && Pos + 1 - ChunkStart >= FCreditsImporter::ChunkSize)
+			{
+				OutChunks.Add({ ChunkStart, Pos + 1 });
+				ChunkStart = Pos + 1;
+			}
+		}
+		if (ChunkStart < End)
+		{
+			OutChunks.Add({ ChunkStart, End });
+		}
+	}
+
+	/**
+	 * Splits the elements of the top level JSON array of Data into chunks of about ChunkSize characters, each a
+	 * comma separated run of whole elements, skipping strings so their brackets and commas are not counted.
+	 */
+	static void SplitJson(const TCHAR* Data, int32 Length, TArray<FChunk>& OutChunks)
+	{
+		int32 Depth = 0;
+		int32 ChunkStart = INDEX_NONE;
+		for (int32 Pos = 0; Pos < Length; ++Pos)
+		{
+			const TCHAR Char = Data[Pos];
+			if (Char == TEXT('"'))
+			{
+				for (++Pos; Pos < Length && Data[Pos] != TEXT('"'); ++Pos)
+				{
+					Pos += Data[Pos] == TEXT('\\') ? 1 : 0;
+				}
+			}
+			else if (Char == TEXT('[') || Char == TEXT('{'))
+			{
+				if (++Depth == 1)
+				{
+					ChunkStart = Pos + 1;
+				}
+			}
+			else if (Char == TEXT(']') || Char == TEXT('}'))
+			{
+				if (--Depth == 0)
+				{
+					if (ChunkStart != INDEX_NONE && ChunkStart < Pos)
+					{
+						OutChunks.Add({ ChunkStart, Pos });
+					}
+					return;
+				}
+			}
+			else if (Char == TEXT(',') && Depth == 1 && Pos - ChunkStart >= FCreditsImporter::ChunkSize)
+			{
+				OutChunks.Add({ ChunkStart, Pos });
+				ChunkStart = Pos + 1;
+			}
+		}
+	}
+
+	static void ParseCsvChunk(const TCHAR* Data, const FChunk& Chunk, const FCsvColumns& Columns, TArray<FCreditsImportRecord>& OutRecords)
+	{
+		TArray<FString> Fields;
+		int32 Pos = Chunk.Start;
+		while (ParseCsvRow(Data, Pos, Chunk.End, Fields))
+		{
+			FCreditsImportRecord Record;
+			Record.Section = TakeField(Fields, Columns.Section);
+			Record.Role = TakeField(Fields, Columns.Role);
+			Record.Name = TakeField(Fields, Columns.Name);
+			Record.Image = TakeField(Fields, Columns.Image);
+			if (!Record.Section.IsEmpty() || !Record.Role.IsEmpty() || !Record.Name.IsEmpty())
+			{
+				OutRecords.Add(MoveTemp(Record));
+			}
+		}
+	}
+
+	static void ParseJsonChunk(const TCHAR* Data, const FChunk& Chunk, TArray<FCreditsImportRecord>& OutRecords)
+	{
+		FString ChunkText;
+		ChunkText.Reserve(Chunk.End - Chunk.Start + 2);
+		ChunkText.AppendChar(TEXT('['));
+		ChunkText.AppendChars(Data + Chunk.Start, Chunk.End - Chunk.Start);
+		ChunkText.AppendChar(TEXT(']'));
+
+		TArray<TSharedPtr<FJsonValue>> Values;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ChunkText), Values))
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsImporter: could not parse the JSON records at %d"), Chunk.Start);
+			return;
+		}
+
+		OutRecords.Reserve(OutRecords.Num() + Values.Num());
+		for (const TSharedPtr<FJsonValue>& Value : Values)
+		{
+			const TSharedPtr<FJsonObject>* Object = nullptr;
+			if (!Value.IsValid() || !Value->TryGetObject(Object))
+			{
+				continue;
+			}
+
+			FCreditsImportRecord Record;
+			(*Object)->TryGetStringField(TEXT("Section"), Record.Section);
+			(*Object)->TryGetStringField(TEXT("Role"), Record.Role);
+			(*Object)->TryGetStringField(TEXT("Name"), Record.Name);
+			(*Object)->TryGetStringField(TEXT("Image"), Record.Image);
+			OutRecords.Add(MoveTemp(Record));
+		}
+	}
+
+	/** Points ImageProperties at the soft image of the record at RecordIndex, leaving the defaults for INDEX_NONE. */
+	static void SetImage(FCreditsImageProperties& ImageProperties, const TArray<FCreditsImportRecord>& Records, int32 RecordIndex)
+	{
+		if (RecordIndex != INDEX_NONE)
+		{
+			ImageProperties.Image = nullptr;
+			ImageProperties.SoftImage = TSoftObjectPtr<UTexture2D>(FSoftObjectPath(Records[RecordIndex].Image));
+		}
+	}
+
+	static uint64 HashCombine64(uint64 Seed, uint64 Value)
+	{
+		return CityHash128to64(Uint128_64(Seed, Value));
+	}
+
+	static uint64 HashString(uint64 Seed, const FString& String)
+	{
+		return CityHash64WithSeed(reinterpret_cast<const char*>(*String), String.Len() * sizeof(TCHAR), Seed);
+	}
+
+	static uint64 HashTextObject(uint64 Seed, const FCreditsTextObjectSimple& TextObject)
+	{
+		const FCreditsImageProperties& Image = TextObject.ImageProperties;
+		Seed = HashString(Seed, TextObject.Text);
+		Seed = HashCombine64(Seed, GetTypeHash(Image.Image));
+		Seed = HashCombine64(Seed, GetTypeHash(Image.SoftImage.ToSoftObjectPath()));
+		return HashCombine64(Seed, HashCombine(GetTypeHash(Image.ImageSizeOverride), GetTypeHash(Image.ImageSizeProperties)));
+	}
+
+	/**
+	 * Matches RowNames against Table, then writes only the rows IsUnchanged rejects, adding the new ones and
+	 * removing the missing ones. When the import reorders the kept rows, or adds rows while removing others, the
+	 * table cannot keep the import order in place and is rebuilt in order instead.
+	 */
+	static void ApplyRows(UDataTable* Table, const TArray<FName>& RowNames, bool bRemoveMissingRows, TFunctionRef<bool(int32, const uint8*)> IsUnchanged, TFunctionRef<void(int32, uint8*)> Assign, TFunctionRef<const FTableRowBase&(int32)> GetRow, FCreditsImportStats& Stats)
+	{
+		double StartTime = FPlatformTime::Seconds();
+		const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+
+		TArray<uint8*> Existing;
+		Existing.SetNumUninitialized(RowNames.Num());
+		TSet<FName> Imported;
+		Imported.Reserve(RowNames.Num());
+		for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+		{
+			Existing[Index] = RowMap.FindRef(RowNames[Index]);
+			Imported.Add(RowNames[Index]);
+		}
+
+		TArray<bool> Unchanged;
+		Unchanged.SetNumZeroed(RowNames.Num());
+		ParallelFor(RowNames.Num(), [&Existing, &Unchanged, IsUnchanged](int32 Index)
+		{
+			Unchanged[Index] = Existing[Index] != nullptr && IsUnchanged(Index, Existing[Index]);
+		});
+
+		TArray<FName> Missing;
+		TMap<FName, int32> TableOrder;
+		TableOrder.Reserve(RowMap.Num());
+		for (const TPair<FName, uint8*>& Row : RowMap)
+		{
+			TableOrder.Add(Row.Key, TableOrder.Num());
+			if (!Imported.Contains(Row.Key))
+			{
+				Missing.Add(Row.Key);
+			}
+		}
+
+		// kept rows must already be in import order and come before every added row.
+		bool bKeepsOrder = true;
+		bool bAdding = false;
+		int32 LastTableIndex = INDEX_NONE;
+		for (int32 Index = 0; Index < RowNames.Num() && bKeepsOrder; ++Index)
+		{
+			if (Existing[Index] == nullptr)
+			{
+				bAdding = true;
+				continue;
+			}
+			const int32 TableIndex = TableOrder.FindChecked(RowNames[Index]);
+			bKeepsOrder = !bAdding && TableIndex > LastTableIndex;
+			LastTableIndex = TableIndex;
+		}
+		bKeepsOrder &= !(bAdding && bRemoveMissingRows && Missing.Num() > 0);
+
+		for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+		{
+			if (Existing[Index] == nullptr)
+			{
+				++Stats.NumAdded;
+			}
+			else if (Unchanged[Index])
+			{
+				++Stats.NumUnchanged;
+			}
+			else
+			{
+				++Stats.NumChanged;
+			}
+		}
+		Stats.NumRows = RowNames.Num();
+		Stats.NumRemoved = bRemoveMissingRows ? Missing.Num() : 0;
+		Stats.bRebuilt = !bKeepsOrder;
+		Stats.DiffSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		if (Stats.NumAdded == 0 && Stats.NumChanged == 0 && Stats.NumRemoved == 0 && bKeepsOrder)
+		{
+			Stats.ApplySeconds = FPlatformTime::Seconds() - StartTime;
+			return;
+		}
+
+#if WITH_EDITOR
+		Table->Modify();
+#endif
+
+		if (bKeepsOrder)
+		{
+			if (bRemoveMissingRows)
+			{
+				for (const FName& RowName : Missing)
+				{
+					Table->RemoveRow(RowName);
+				}
+			}
+			for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+			{
+				if (Existing[Index] == nullptr)
+				{
+					Table->AddRow(RowNames[Index], GetRow(Index));
+				}
+				else if (!Unchanged[Index])
+				{
+					Assign(Index, Existing[Index]);
+				}
+			}
+		}
+		else
+		{
+			// rows kept despite missing from the import go after the imported ones.
+			const UScriptStruct* RowStruct = Table->GetRowStruct();
+			TArray<uint8*> KeptRows;
+			if (!bRemoveMissingRows)
+			{
+				for (const FName& RowName : Missing)
+				{
+					uint8* RowData = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize(), RowStruct->GetMinAlignment());
+					RowStruct->InitializeStruct(RowData);
+					RowStruct->CopyScriptStruct(RowData, RowMap.FindChecked(RowName));
+					KeptRows.Add(RowData);
+				}
+			}
+
+			Table->EmptyTable();
+			for (int32 Index = 0; Index < RowNames.Num(); ++Index)
+			{
+				Table->AddRow(RowNames[Index], GetRow(Index));
+			}
+			for (int32 Index = 0; Index < KeptRows.Num(); ++Index)
+			{
+				Table->AddRow(Missing[Index], *reinterpret_cast<const FTableRowBase*>(KeptRows[Index]));
+				RowStruct->DestroyStruct(KeptRows[Index]);
+				FMemory::Free(KeptRows[Index]);
+			}
+		}
+
+		// a single changed row is named so listeners can refresh just that row.
+		const bool bSingleRow = Stats.NumAdded + Stats.NumChanged == 1 && Stats.NumRemoved == 0 && bKeepsOrder;
+		FName ChangedRow = NAME_None;
+		for (int32 Index = 0; Index < RowNames.Num() && bSingleRow; ++Index)
+		{
+			ChangedRow = Unchanged[Index] ? ChangedRow : RowNames[Index];
+		}
+		Table->HandleDataTableChanged(ChangedRow);
+#if WITH_EDITOR
+		Table->MarkPackageDirty();
+#endif
+		Stats.ApplySeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	static void LogStats(const UDataTable* Table, const FCreditsImportStats& Stats)
+	{
+		UE_LOG(ClosingCreditsLog, Display, TEXT("FCreditsImporter: %s, %d records into %d rows: %d added, %d changed, %d unchanged, %d removed%s"),
+			*GetNameSafe(Table), Stats.NumRecords, Stats.NumRows, Stats.NumAdded, Stats.NumChanged, Stats.NumUnchanged, Stats.NumRemoved, Stats.bRebuilt ? TEXT(", rebuilt in order") : TEXT(""));
+		UE_LOG(ClosingCreditsLog, Display, TEXT("FCreditsImporter: parse %.3f ms, build %.3f ms, diff %.3f ms, apply %.3f ms"),
+			Stats.ParseSeconds * 1000.0, Stats.BuildSeconds * 1000.0, Stats.DiffSeconds * 1000.0, Stats.ApplySeconds * 1000.0);
+	}
+}
+
+bool FCreditsImporter::ImportFile(UDataTable* Table, const FString& Filename, bool bRemoveMissingRows, FCreditsImportStats* OutStats)
+{
+	FString Text;
+	if (Table == nullptr || !FFileHelper::LoadFileToString(Text, *Filename))
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsImporter: could not read %s"), *Filename);
+		return false;
+	}
+
+	const ECreditsImportFormat Format = FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase) ? ECreditsImportFormat::Json : ECreditsImportFormat::Csv;
+	if (Table->GetRowStruct() == FCreditsSectionSimple::StaticStruct())
+	{
+		return ImportSections(Table, Text, Format, bRemoveMissingRows, OutStats);
+	}
+	return ImportRows(Table, Text, Format, bRemoveMissingRows, OutStats);
+}
+
+bool FCreditsImporter::ImportSections(UDataTable* Table, const FString& Text, ECreditsImportFormat Format, bool bRemoveMissingRows, FCreditsImportStats* OutStats)
+{
+	check(IsInGameThread());
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsImport);
+	LLM_SCOPE_BYTAG(Credits);
+	if (Table == nullptr || Table->GetRowStruct() != FCreditsSectionSimple::StaticStruct())
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsImporter: %s is not a table of FCreditsSectionSimple rows"), *GetNameSafe(Table));
+		return false;
+	}
+
+	FCreditsImportStats Stats;
+	double StartTime = FPlatformTime::Seconds();
+	TArray<FCreditsImportRecord> Records;
+	ParseRecords(Text, Format, Records);
+	Stats.NumRecords = Records.Num();
+	Stats.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	TArray<FName> RowNames;
+	TArray<FCreditsSectionSimple> Sections;
+	TArray<uint64> Hashes;
+	BuildSections(Records, RowNames, Sections, Hashes);
+	Stats.BuildSeconds = FPlatformTime::Seconds() - StartTime;
+
+	CreditsImporter::ApplyRows(Table, RowNames, bRemoveMissingRows,
+		[&Hashes](int32 Index, const uint8* Row)
+		{
+			return GetSectionHash(*reinterpret_cast<const FCreditsSectionSimple*>(Row)) == Hashes[Index];
+		},
+		[&Sections](int32 Index, uint8* Row)
+		{
+			*reinterpret_cast<FCreditsSectionSimple*>(Row) = MoveTemp(Sections[Index]);
+		},
+		[&Sections](int32 Index) -> const FTableRowBase&
+		{
+			return Sections[Index];
+		},
+		Stats);
+
+	CreditsImporter::LogStats(Table, Stats);
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return true;
+}
+
+bool FCreditsImporter::ImportRows(UDataTable* Table, const FString& Text, ECreditsImportFormat Format, bool bRemoveMissingRows, FCreditsImportStats* OutStats)
+{
+	check(IsInGameThread());
+	const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+	if (RowStruct == nullptr)
+	{
+		return false;
+	}
+
+	// the DataTable format carries whole structs per cell, the engine parser reads it into a staging table.
+	FCreditsImportStats Stats;
+	double StartTime = FPlatformTime::Seconds();
+	UDataTable* Staging = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+	Staging->RowStruct = Table->RowStruct;
+	const TArray<FString> Problems = Format == ECreditsImportFormat::Json ? Staging->CreateTableFromJSONString(Text) : Staging->CreateTableFromCSVString(Text);
+	for (const FString& Problem : Problems)
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsImporter: %s: %s"), *GetNameSafe(Table), *Problem);
+	}
+	Stats.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TArray<FName> RowNames;
+	TArray<uint8*> Rows;
+	Staging->GetRowMap().GenerateKeyArray(RowNames);
+	Staging->GetRowMap().GenerateValueArray(Rows);
+	Stats.NumRecords = Rows.Num();
+
+	CreditsImporter::ApplyRows(Table, RowNames, bRemoveMissingRows,
+		[RowStruct, &Rows](int32 Index, const uint8* Row)
+		{
+			return RowStruct->CompareScriptStruct(Row, Rows[Index], PPF_None);
+		},
+		[RowStruct, &Rows](int32 Index, uint8* Row)
+		{
+			RowStruct->CopyScriptStruct(Row, Rows[Index]);
+		},
+		[&Rows](int32 Index) -> const FTableRowBase&
+		{
+			return *reinterpret_cast<const FTableRowBase*>(Rows[Index]);
+		},
+		Stats);
+
+	Staging->EmptyTable();
+	CreditsImporter::LogStats(Table, Stats);
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return true;
+}
+
+void FCreditsImporter::ParseRecords(const FString& Text, ECreditsImportFormat Format, TArray<FCreditsImportRecord>& OutRecords)
+{
+	OutRecords.Reset();
+	const TCHAR* Data = *Text;
+
+	TArray<CreditsImporter::FChunk> Chunks;
+	CreditsImporter::FCsvColumns Columns;
+	if (Format == ECreditsImportFormat::Json)
+	{
+		CreditsImporter::SplitJson(Data, Text.Len(), Chunks);
+	}
+	else
+	{
+		int32 Pos = 0;
+		TArray<FString> Header;
+		CreditsImporter::ParseCsvRow(Data, Pos, Text.Len(), Header);
+		for (int32 Column = 0; Column < Header.Num(); ++Column)
+		{
+			const FString ColumnName = Header[Column].TrimStartAndEnd();
+			int32* Target = ColumnName == TEXT("Section") ? &Columns.Section
+				: ColumnName == TEXT("Role") ? &Columns.Role
+				: ColumnName == TEXT("Name") ? &Columns.Name
+				: ColumnName == TEXT("Image") ? &Columns.Image
+				: nullptr;
+			if (Target)
+			{
+				*Target = Column;
+			}
+		}
+		if (Columns.Section == INDEX_NONE && Columns.Name == INDEX_NONE)
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsImporter: the CSV header has neither a Section nor a Name column"));
+			return;
+		}
+		CreditsImporter::SplitCsv(Data, Pos, Text.Len(), Chunks);
+	}
+
+	TArray<TArray<FCreditsImportRecord>> ChunkRecords;
+	ChunkRecords.SetNum(Chunks.Num());
+	ParallelFor(Chunks.Num(), [Data, Format, &Chunks, &Columns, &ChunkRecords](int32 ChunkIndex)
+	{
+		if (Format == ECreditsImportFormat::Json)
+		{
+			CreditsImporter::ParseJsonChunk(Data, Chunks[ChunkIndex], ChunkRecords[ChunkIndex]);
+		}
+		else
+		{
+			CreditsImporter::ParseCsvChunk(Data, Chunks[ChunkIndex], Columns, ChunkRecords[ChunkIndex]);
+		}
+	});
+
+	int32 NumRecords = 0;
+	for (const TArray<FCreditsImportRecord>& Records : ChunkRecords)
+	{
+		NumRecords += Records.Num();
+	}
+	OutRecords.Reserve(NumRecords);
+	for (TArray<FCreditsImportRecord>& Records : ChunkRecords)
+	{
+		OutRecords.Append(MoveTemp(Records));
+	}
+}
+
+void FCreditsImporter::BuildSections(const TArray<FCreditsImportRecord>& Records, TArray<FName>& OutRowNames, TArray<FCreditsSectionSimple>& OutSections, TArray<uint64>& OutHashes)
+{
+	using namespace CreditsImporter;
+
+	// grouping is order dependent, so only record indices are gathered here and the rows are built in parallel.
+	TArray<FSectionPlan> Plans;
+	TMap<FString, int32> SectionLookup;
+	for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+	{
+		const FCreditsImportRecord& Record = Records[RecordIndex];
+		const int32* FoundSection = SectionLookup.Find(Record.Section);
+		const int32 SectionIndex = FoundSection ? *FoundSection : SectionLookup.Add(Record.Section, Plans.Num());
+		if (FoundSection == nullptr)
+		{
+			Plans.AddDefaulted_GetRef().Title = RecordIndex;
+		}
+		FSectionPlan& Plan = Plans[SectionIndex];
+
+		const int32 ImageIndex = Record.Image.IsEmpty() ? INDEX_NONE : RecordIndex;
+		if (Record.Role.IsEmpty() && Record.Name.IsEmpty())
+		{
+			Plan.Image = ImageIndex != INDEX_NONE ? ImageIndex : Plan.Image;
+			continue;
+		}
+
+		const int32* FoundRole = Plan.RoleLookup.Find(Record.Role);
+		const int32 RoleIndex = FoundRole ? *FoundRole : Plan.RoleLookup.Add(Record.Role, Plan.Roles.Num());
+		if (FoundRole == nullptr)
+		{
+			Plan.Roles.AddDefaulted_GetRef().Role = RecordIndex;
+		}
+		FRolePlan& Role = Plan.Roles[RoleIndex];
+
+		if (Record.Name.IsEmpty())
+		{
+			Role.Image = ImageIndex != INDEX_NONE ? ImageIndex : Role.Image;
+		}
+		else
+		{
+			Role.Names.Add(RecordIndex);
+		}
+	}
+
+	// the struct defaults only resolve on the game thread, workers then only read them.
+	FCreditsDefaultAssets::Get();
+
+	OutRowNames.SetNum(Plans.Num());
+	OutSections.SetNum(Plans.Num());
+	OutHashes.SetNum(Plans.Num());
+	ParallelFor(Plans.Num(), [&Records, &Plans, &OutRowNames, &OutSections, &OutHashes](int32 SectionIndex)
+	{
+		const FSectionPlan& Plan = Plans[SectionIndex];
+		FCreditsSectionSimple& Section = OutSections[SectionIndex];
+		Section.Title.Text = Records[Plan.Title].Section;
+		SetImage(Section.Title.ImageProperties, Records, Plan.Image);
+
+		Section.Roles.SetNum(Plan.Roles.Num());
+		for (int32 RoleIndex = 0; RoleIndex < Plan.Roles.Num(); ++RoleIndex)
+		{
+			const FRolePlan& RolePlan = Plan.Roles[RoleIndex];
+			FCreditsRoleStructSimple& Role = Section.Roles[RoleIndex];
+			Role.Role.Text = Records[RolePlan.Role].Role;
+			Role.DisplayRoleName = !Role.Role.Text.IsEmpty();
+			SetImage(Role.Role.ImageProperties, Records, RolePlan.Image);
+
+			Role.PlayedBy.SetNum(RolePlan.Names.Num());
+			for (int32 NameIndex = 0; NameIndex < RolePlan.Names.Num(); ++NameIndex)
+			{
+				const int32 RecordIndex = RolePlan.Names[NameIndex];
+				Role.PlayedBy[NameIndex].Text = Records[RecordIndex].Name;
+				SetImage(Role.PlayedBy[NameIndex].ImageProperties, Records, Records[RecordIndex].Image.IsEmpty() ? INDEX_NONE : RecordIndex);
+			}
+		}
+
+		OutRowNames[SectionIndex] = Section.Title.Text.IsEmpty() ? FName(TEXT("Section"), SectionIndex + 1) : FName(*Section.Title.Text);
+		OutHashes[SectionIndex] = GetSectionHash(Section);
+	});
+}
+
+uint64 FCreditsImporter::GetSectionHash(const FCreditsSectionSimple& Section)
+{
+	using namespace CreditsImporter;
+
+	uint64 Hash = HashTextObject(Section.Roles.Num(), Section.Title);
+	for (const FCreditsRoleStructSimple& Role : Section.Roles)
+	{
+		Hash = HashTextObject(HashCombine64(Hash, Role.PlayedBy.Num() * 2 + Role.DisplayRoleName), Role.Role);
+		for (const FCreditsTextObjectSimple& Name : Role.PlayedBy)
+		{
+			Hash = HashTextObject(Hash, Name);
+		}
+	}
+	return Hash;
+}
+
+#if WITH_EDITOR
+static FAutoConsoleCommand CreditsImportCommand(
+	TEXT("Credits.Import"),
+	TEXT("Credits.Import <DataTable path> <CSV or JSON file> [keep], imports the file into the table, only touching the rows that changed. keep leaves rows missing from the file."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UDataTable* Table = Args.Num() >= 2 ? LoadObject<UDataTable>(nullptr, *Args[0]) : nullptr;
+		if (Table == nullptr)
+		{
+			UE_LOG(ClosingCreditsLog, Warning, TEXT("Credits.Import: expected a DataTable path and a file"));
+			return;
+		}
+		FCreditsImporter::ImportFile(Table, Args[1], !(Args.Num() > 2 && Args[2] == TEXT("keep")));
+	}));
+#endif
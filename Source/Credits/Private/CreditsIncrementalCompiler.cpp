@@ -0,0 +1,433 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsIncrementalCompiler.h"
+#include "Async/ParallelFor.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformTime.h"
+#include "CreditsCompiler.h"
+#include "CreditsConverter.h"
+#include "CreditsImporter.h"
+#include "CreditsLayout.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsStats.h"
+
+/** Records the override key of every row of Table when its row struct matches RowType. */
+template<typename RowType, typename MakeKeyType>
+static void GatherCreditsOverrideRows(const UDataTable* Table, MakeKeyType&& MakeKey, TMap<FName, FCreditsOverrideKey>& OutRowKeys)
+{
+	OutRowKeys.Reset();
+	const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+	if (!RowStruct || !RowStruct->IsChildOf(RowType::StaticStruct()))
+	{
+		return;
+	}
+
+	OutRowKeys.Reserve(Table->GetRowMap().Num());
+	for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+	{
+		OutRowKeys.Add(Row.Key, MakeKey(Row.Key, *reinterpret_cast<const RowType*>(Row.Value)));
+	}
+}
+
+/**
+ * Patches the overrides of the keys the changed rows of Table held before and hold now, adding to OutKeys the keys
+ * it touched. Rows sharing a key resolve as the index built from the whole table does, the last one wins.
+ */
+template<typename RowType, typename MakeKeyType, typename AddType, typename RemoveType>
+static void PatchCreditsOverrideRows(const UDataTable* Table, const TSet<FName>& RowNames, TMap<FName, FCreditsOverrideKey>& RowKeys, MakeKeyType&& MakeKey, AddType&& Add, RemoveType&& Remove, TArray<FCreditsOverrideKey>& OutKeys)
+{
+	const int32 FirstKey = OutKeys.Num();
+	for (const FName& RowName : RowNames)
+	{
+		if (const FCreditsOverrideKey* OldKey = RowKeys.Find(RowName))
+		{
+			OutKeys.AddUnique(*OldKey);
+		}
+		if (const RowType* Row = reinterpret_cast<const RowType*>(Table->FindRowUnchecked(RowName)))
+		{
+			const FCreditsOverrideKey Key = MakeKey(RowName, *Row);
+			RowKeys.Add(RowName, Key);
+			OutKeys.AddUnique(Key);
+		}
+	}
+
+	for (int32 Index = FirstKey; Index < OutKeys.Num(); ++Index)
+	{
+		const FCreditsOverrideKey& Key = OutKeys[Index];
+		FName LastRow = NAME_None;
+		for (const TPair<FName, FCreditsOverrideKey>& RowKey : RowKeys)
+		{
+			LastRow = RowKey.Value == Key ? RowKey.Key : LastRow;
+		}
+
+		if (LastRow.IsNone())
+		{
+			Remove(Key);
+		}
+		else
+		{
+			Add(LastRow, *reinterpret_cast<const RowType*>(Table->FindRowUnchecked(LastRow)));
+		}
+	}
+}
+
+static FCreditsOverrideKey MakeSectionOverrideKey(const FName& RowName, const FCreditsSectionOverride& Row)
+{
+	return FCreditsOverrideKey(RowName, NAME_None, NAME_None);
+}
+
+static FCreditsOverrideKey MakeRoleOverrideKey(const FName& RowName, const FCreditsRoleOverride& Row)
+{
+	return FCreditsOverrideKey(Row.ParentSection, Row.RoleToOverride, NAME_None);
+}
+
+static FCreditsOverrideKey MakeNameOverrideKey(const FName& RowName, const FCreditsNameOverrides& Row)
+{
+	return FCreditsOverrideKey(Row.ParentSection, Row.ParentRole, Row.NameToOverride);
+}
+
+FCreditsIncrementalCompiler::FCreditsIncrementalCompiler(UDataTable* InSections, UDataTable* InSectionOverrides, UDataTable* InRoleOverrides, UDataTable* InNameOverrides)
+	: Sections(InSections)
+	, SectionOverrides(InSectionOverrides)
+	, RoleOverrides(InRoleOverrides)
+	, NameOverrides(InNameOverrides)
+	, Compiled(MakeShared<FCreditsCompiledCredits>())
+	, Overrides(MakeShared<FCreditsOverrideIndex>())
+	, bSimpleRows(false)
+{
+}
+
+FCreditsIncrementalCompiler::~FCreditsIncrementalCompiler()
+{
+	OnCreditsRowChanged().Remove(RowChangedHandle);
+	for (const TPair<UDataTable*, FDelegateHandle>& TableHandle : TableHandles)
+	{
+		if (IsValid(TableHandle.Key))
+		{
+			TableHandle.Key->OnDataTableChanged().Remove(TableHandle.Value);
+		}
+	}
+}
+
+void FCreditsIncrementalCompiler::Start()
+{
+	check(IsInGameThread());
+	CompileAll();
+
+	for (UDataTable* Table : { Sections, SectionOverrides, RoleOverrides, NameOverrides })
+	{
+		if (Table)
+		{
+			TableHandles.Emplace(Table, Table->OnDataTableChanged().AddSP(this, &FCreditsIncrementalCompiler::HandleTableChanged, Table));
+		}
+	}
+	RowChangedHandle = OnCreditsRowChanged().AddSP(this, &FCreditsIncrementalCompiler::HandleRowChanged);
+}
+
+int32 FCreditsIncrementalCompiler::Update()
+{
+	check(IsInGameThread());
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsRecompile);
+	LLM_SCOPE_BYTAG(Credits);
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSet<const UDataTable*> Tables = MoveTemp(ChangedTables);
+	TMap<const UDataTable*, TSet<FName>> RowNames = MoveTemp(ChangedRowNames);
+	ChangedTables.Reset();
+	ChangedRowNames.Reset();
+
+	// called directly rather than by a change notification, every table is checked whole.
+	if (Tables.Num() == 0)
+	{
+		Tables.Append({ Sections, SectionOverrides, RoleOverrides, NameOverrides });
+	}
+
+	const UScriptStruct* RowStruct = Sections ? Sections->GetRowStruct() : nullptr;
+	const bool bNowSimpleRows = RowStruct && RowStruct->IsChildOf(FCreditsSectionSimple::StaticStruct());
+
+	// a row added, removed or moved shifts every section after it, so only edits in place are spliced.
+	bool bFullRecompile = !bSimpleRows || !bNowSimpleRows || Sections->GetRowMap().Num() != SectionStates.Num();
+	TArray<const uint8*> Rows;
+	if (!bFullRecompile)
+	{
+		Rows.Reserve(SectionStates.Num());
+		for (const TPair<FName, uint8*>& Row : Sections->GetRowMap())
+		{
+			if (Row.Key != SectionStates[Rows.Num()].Key)
+			{
+				bFullRecompile = true;
+				break;
+			}
+			Rows.Add(Row.Value);
+		}
+	}
+
+	if (bFullRecompile)
+	{
+		CompileAll();
+		OnRecompiled.Broadcast(0, true, TArray<int32>());
+		UE_LOG(ClosingCreditsLog, Verbose, TEXT("FCreditsIncrementalCompiler: full recompile of %d sections, %.3f ms"), SectionStates.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		return 0;
+	}
+
+	const int32 NumSections = SectionStates.Num();
+	TArray<bool> Dirty;
+	Dirty.SetNumZeroed(NumSections);
+
+	if (Tables.Contains(Sections))
+	{
+		if (const TSet<FName>* SectionRows = RowNames.Find(Sections))
+		{
+			// the table named the rows that changed, only those are hashed again.
+			for (const FName& RowName : *SectionRows)
+			{
+				if (const int32* SectionIndex = SectionIndices.Find(RowName))
+				{
+					const uint64 Hash = FCreditsImporter::GetSectionHash(*reinterpret_cast<const FCreditsSectionSimple*>(Rows[*SectionIndex]));
+					Dirty[*SectionIndex] = Hash != SectionStates[*SectionIndex].Hash;
+				}
+			}
+		}
+		else
+		{
+			ParallelFor(NumSections, [this, &Rows, &Dirty](int32 SectionIndex)
+			{
+				Dirty[SectionIndex] = FCreditsImporter::GetSectionHash(*reinterpret_cast<const FCreditsSectionSimple*>(Rows[SectionIndex])) != SectionStates[SectionIndex].Hash;
+			});
+		}
+	}
+
+	UpdateOverrides(Tables, RowNames, Dirty);
+
+	int32 FirstLine = INDEX_NONE;
+	int32 NumRecompiled = 0;
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		if (Dirty[SectionIndex])
+		{
+			if (FirstLine == INDEX_NONE)
+			{
+				int32 SectionEnd;
+				Compiled->Lines.GetSectionRange(SectionIndex, FirstLine, SectionEnd);
+			}
+			RecompileSection(SectionIndex, Rows[SectionIndex]);
+			++NumRecompiled;
+		}
+	}
+
+	// the styles and images only the replaced sections used are dropped, every line may then point at new indices.
+	TArray<int32> ImageRemap;
+	if (FirstLine != INDEX_NONE && Compiled->CompactTables(ImageRemap))
+	{
+		FirstLine = 0;
+	}
+
+	if (FirstLine != INDEX_NONE)
+	{
+		OnRecompiled.Broadcast(FirstLine, false, ImageRemap);
+		UE_LOG(ClosingCreditsLog, Verbose, TEXT("FCreditsIncrementalCompiler: recompiled %d of %d sections, %.3f ms"), NumRecompiled, NumSections, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	return FirstLine;
+}
+
+void FCreditsIncrementalCompiler::CompileAll()
+{
+	Overrides->Build(SectionOverrides, RoleOverrides, NameOverrides);
+	GatherOverrideRows();
+
+	const UScriptStruct* RowStruct = Sections ? Sections->GetRowStruct() : nullptr;
+	bSimpleRows = RowStruct && RowStruct->IsChildOf(FCreditsSectionSimple::StaticStruct());
+
+	TArray<FCreditsSection> Converted;
+	TArray<const uint8*> Rows;
+	if (bSimpleRows)
+	{
+		FCreditsConverter::ConvertDataTable(Sections, &Overrides.Get(), Converted);
+	}
+	else if (RowStruct && RowStruct->IsChildOf(FCreditsSection::StaticStruct()))
+	{
+		Converted.Reserve(Sections->GetRowMap().Num());
+		for (const TPair<FName, uint8*>& Row : Sections->GetRowMap())
+		{
+			Converted.Add(*reinterpret_cast<const FCreditsSection*>(Row.Value));
+		}
+	}
+
+	FCreditsCompiler::Compile(Converted, *Compiled);
+	FCreditsLayout::Layout(*Compiled);
+
+	SectionStates.Reset();
+	SectionIndices.Reset();
+	if (bSimpleRows)
+	{
+		SectionStates.SetNum(Sections->GetRowMap().Num());
+		SectionIndices.Reserve(SectionStates.Num());
+		for (const TPair<FName, uint8*>& Row : Sections->GetRowMap())
+		{
+			SectionStates[Rows.Num()].Key = Row.Key;
+			SectionIndices.Add(Row.Key, Rows.Num());
+			Rows.Add(Row.Value);
+		}
+		ParallelFor(Rows.Num(), [this, &Rows](int32 SectionIndex)
+		{
+			GatherSection(Rows[SectionIndex], SectionStates[SectionIndex]);
+		});
+	}
+}
+
+void FCreditsIncrementalCompiler::GatherOverrideRows()
+{
+	GatherCreditsOverrideRows<FCreditsSectionOverride>(SectionOverrides, &MakeSectionOverrideKey, SectionOverrideRows);
+	GatherCreditsOverrideRows<FCreditsRoleOverride>(RoleOverrides, &MakeRoleOverrideKey, RoleOverrideRows);
+	GatherCreditsOverrideRows<FCreditsNameOverrides>(NameOverrides, &MakeNameOverrideKey, NameOverrideRows);
+}
+
+void FCreditsIncrementalCompiler::UpdateOverrides(const TSet<const UDataTable*>& Tables, const TMap<const UDataTable*, TSet<FName>>& RowNames, TArray<bool>& Dirty)
+{
+	// rows added, removed or renamed are not named by the table, nor worth patching one by one when all of them are.
+	const auto CanPatch = [&Tables, &RowNames](const UDataTable* Table, const TMap<FName, FCreditsOverrideKey>& RowKeys)
+	{
+		if (!Table || !Tables.Contains(Table))
+		{
+			return true;
+		}
+		const TSet<FName>* TableRows = RowNames.Find(Table);
+		return TableRows && TableRows->Num() < RowKeys.Num() && Table->GetRowMap().Num() == RowKeys.Num();
+	};
+
+	TArray<FCreditsOverrideKey> SectionKeys;
+	TArray<FCreditsOverrideKey> RoleKeys;
+	TArray<FCreditsOverrideKey> NameKeys;
+	if (CanPatch(SectionOverrides, SectionOverrideRows) && CanPatch(RoleOverrides, RoleOverrideRows) && CanPatch(NameOverrides, NameOverrideRows))
+	{
+		FCreditsOverrideIndex& OverrideIndex = Overrides.Get();
+		if (const TSet<FName>* TableRows = SectionOverrides ? RowNames.Find(SectionOverrides) : nullptr)
+		{
+			PatchCreditsOverrideRows<FCreditsSectionOverride>(SectionOverrides, *TableRows, SectionOverrideRows, &MakeSectionOverrideKey,
+				[&OverrideIndex](const FName& RowName, const FCreditsSectionOverride& Row) { OverrideIndex.AddSectionOverride(RowName, Row.OverrideData); },
+				[&OverrideIndex](const FCreditsOverrideKey& Key) { OverrideIndex.RemoveSectionOverride(Key.Section); },
+				SectionKeys);
+		}
+		if (const TSet<FName>* TableRows = RoleOverrides ? RowNames.Find(RoleOverrides) : nullptr)
+		{
+			PatchCreditsOverrideRows<FCreditsRoleOverride>(RoleOverrides, *TableRows, RoleOverrideRows, &MakeRoleOverrideKey,
+				[&OverrideIndex](const FName& RowName, const FCreditsRoleOverride& Row) { OverrideIndex.AddRoleOverride(Row); },
+				[&OverrideIndex](const FCreditsOverrideKey& Key) { OverrideIndex.RemoveRoleOverride(Key); },
+				RoleKeys);
+		}
+		if (const TSet<FName>* TableRows = NameOverrides ? RowNames.Find(NameOverrides) : nullptr)
+		{
+			PatchCreditsOverrideRows<FCreditsNameOverrides>(NameOverrides, *TableRows, NameOverrideRows, &MakeNameOverrideKey,
+				[&OverrideIndex](const FName& RowName, const FCreditsNameOverrides& Row) { OverrideIndex.AddNameOverride(Row); },
+				[&OverrideIndex](const FCreditsOverrideKey& Key) { OverrideIndex.RemoveNameOverride(Key); },
+				NameKeys);
+		}
+	}
+	else
+	{
+		TSharedRef<FCreditsOverrideIndex> NewOverrides = MakeShared<FCreditsOverrideIndex>();
+		NewOverrides->Build(SectionOverrides, RoleOverrides, NameOverrides);
+		Overrides->GetChangedKeys(*NewOverrides, SectionKeys, RoleKeys, NameKeys);
+		Overrides = NewOverrides;
+		GatherOverrideRows();
+	}
+
+	TArray<FName> SectionNames;
+	for (const FCreditsOverrideKey& Key : SectionKeys)
+	{
+		SectionNames.Add(Key.Section);
+	}
+	MarkOverriddenSections(SectionNames, RoleKeys, NameKeys, Dirty);
+}
+
+void FCreditsIncrementalCompiler::RecompileSection(int32 SectionIndex, const uint8* Row)
+{
+	FSectionState& State = SectionStates[SectionIndex];
+
+	FCreditsSection Converted;
+	FCreditsConverter::ConvertSection(*reinterpret_cast<const FCreditsSectionSimple*>(Row), &Overrides.Get(), State.Key, Converted);
+
+	// the section compiles into a table of its own, sharing the styles and images of the credits.
+	FCreditsLineTable SectionLines;
+	Swap(Compiled->Lines, SectionLines);
+	const bool bMeasured = SectionLines.bMeasured;
+	FCreditsCompiler::CompileSection(Converted, *Compiled);
+	if (bMeasured)
+	{
+		FCreditsLayout::Layout(*Compiled);
+	}
+	else
+	{
+		Compiled->Lines.UpdateOffsets();
+	}
+	Swap(Compiled->Lines, SectionLines);
+
+	Compiled->Lines.ReplaceSection(SectionIndex, SectionLines);
+
+	GatherSection(Row, State);
+}
+
+void FCreditsIncrementalCompiler::GatherSection(const uint8* Row, FSectionState& State)
+{
+	const FCreditsSectionSimple& Section = *reinterpret_cast<const FCreditsSectionSimple*>(Row);
+	State.Hash = FCreditsImporter::GetSectionHash(Section);
+	State.RoleKeys.Reset(Section.Roles.Num());
+	State.NameKeys.Reset();
+	for (const FCreditsRoleStructSimple& Role : Section.Roles)
+	{
+		State.RoleKeys.Add(FName(*Role.Role.Text));
+		for (const FCreditsTextObjectSimple& Name : Role.PlayedBy)
+		{
+			State.NameKeys.Add(FName(*Name.Text));
+		}
+	}
+}
+
+void FCreditsIncrementalCompiler::MarkOverriddenSections(const TArray<FName>& SectionKeys, const TArray<FCreditsOverrideKey>& RoleKeys, const TArray<FCreditsOverrideKey>& NameKeys, TArray<bool>& Dirty) const
+{
+	// overrides without a parent section apply to any section holding the role or name, a few extra sections may be compiled.
+	ParallelFor(SectionStates.Num(), [this, &SectionKeys, &RoleKeys, &NameKeys, &Dirty](int32 SectionIndex)
+	{
+		const FSectionState& State = SectionStates[SectionIndex];
+		bool bOverridden = SectionKeys.Contains(State.Key);
+		for (int32 Index = 0; !bOverridden && Index < RoleKeys.Num(); ++Index)
+		{
+			const FCreditsOverrideKey& Key = RoleKeys[Index];
+			bOverridden = (Key.Section.IsNone() || Key.Section == State.Key) && State.RoleKeys.Contains(Key.Role);
+		}
+		for (int32 Index = 0; !bOverridden && Index < NameKeys.Num(); ++Index)
+		{
+			const FCreditsOverrideKey& Key = NameKeys[Index];
+			bOverridden = (Key.Section.IsNone() || Key.Section == State.Key) && State.NameKeys.Contains(Key.Name);
+		}
+		Dirty[SectionIndex] |= bOverridden;
+	});
+}
+
+void FCreditsIncrementalCompiler::HandleTableChanged(UDataTable* Table)
+{
+	ChangedTables.Add(Table);
+	Update();
+}
+
+void FCreditsIncrementalCompiler::HandleRowChanged(const UDataTable* Table, FName RowName)
+{
+	if (Table && (Table == Sections || Table == SectionOverrides || Table == RoleOverrides || Table == NameOverrides))
+	{
+		ChangedRowNames.FindOrAdd(Table).Add(RowName);
+	}
+}
+
+void FCreditsIncrementalCompiler::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Sections);
+	Collector.AddReferencedObject(SectionOverrides);
+	Collector.AddReferencedObject(RoleOverrides);
+	Collector.AddReferencedObject(NameOverrides);
+}
+
+FString FCreditsIncrementalCompiler::GetReferencerName() const
+{
+	return TEXT("FCreditsIncrementalCompiler");
+}
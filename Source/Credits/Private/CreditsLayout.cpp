@@ -0,0 +1,138 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsLayout.h"
+#include "Async/ParallelFor.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/SlateRenderer.h"
+#include "CreditsCompiler.h"
+#include "CreditsStats.h"
+
+/** Lines summed up by each worker task. */
+static const int32 CreditsLayoutBatchSize = 1024;
+
+/** Simple struct for the measured glyphs of one closing credits style. */
+struct FCreditsStyleGlyphs
+{
+	/** reference to the advance of every ASCII character. */
+	float AsciiAdvances[128];
+
+	/** reference to the advance of the other characters used by the style. */
+	TMap<TCHAR, float> Advances;
+
+	/** reference to the height of a line of text. */
+	float LineHeight = 0.0f;
+
+	/** reference to whether any text line uses the style, the others are not measured. */
+	bool bUsed = false;
+
+	FORCEINLINE float GetAdvance(TCHAR Char) const
+	{
+		if ((uint32)Char < 128)
+		{
+			return AsciiAdvances[Char];
+		}
+		const float* Advance = Advances.Find(Char);
+		return Advance ? *Advance : 0.0f;
+	}
+};
+
+bool FCreditsLayout::Layout(FCreditsCompiledCredits& Credits)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsLayout);
+	LLM_SCOPE_BYTAG(Credits);
+
+	FCreditsLineTable& Lines = Credits.Lines;
+
+	// measured heights replace the estimates in place, so the lines are only ever measured once.
+	if (Lines.bMeasured)
+	{
+		Lines.UpdateOffsets();
+		return true;
+	}
+
+	if (!IsInGameThread() || !FSlateApplication::IsInitialized() || !FSlateApplication::Get().GetRenderer())
+	{
+		Lines.UpdateOffsets();
+		return false;
+	}
+
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	const int32 NumStyles = Credits.Styles.Num();
+	const int32 NumLines = Lines.Num();
+
+	// the font cache belongs to the game thread, so every glyph a style uses is measured here, once.
+	TArray<FCreditsStyleGlyphs> StyleGlyphs;
+	StyleGlyphs.SetNum(NumStyles);
+	for (int32 Line = 0; Line < NumLines; ++Line)
+	{
+		if (Lines.Kinds[Line] == ECreditsLineKind::Image)
+		{
+			continue;
+		}
+
+		FCreditsStyleGlyphs& Glyphs = StyleGlyphs[Lines.StyleIndices[Line]];
+		Glyphs.bUsed = true;
+
+		TMap<TCHAR, float>& Advances = Glyphs.Advances;
+		for (const TCHAR Char : Lines.GetText(Line))
+		{
+			if ((uint32)Char >= 128)
+			{
+				Advances.Add(Char, 0.0f);
+			}
+		}
+	}
+
+	for (int32 StyleIndex = 0; StyleIndex < NumStyles; ++StyleIndex)
+	{
+		// a single recompiled section usually uses a few of the styles only.
+		FCreditsStyleGlyphs& Glyphs = StyleGlyphs[StyleIndex];
+		if (!Glyphs.bUsed)
+		{
+			continue;
+		}
+		const FSlateFontInfo& FontInfo = Credits.Styles.GetFontInfo(StyleIndex);
+
+		for (int32 Char = 0; Char < 128; ++Char)
+		{
+			Glyphs.AsciiAdvances[Char] = FChar::IsPrint((TCHAR)Char) ? FontMeasure->Measure(FString::Chr((TCHAR)Char), FontInfo).X : 0.0f;
+		}
+		for (TPair<TCHAR, float>& Advance : Glyphs.Advances)
+		{
+			Advance.Value = FontMeasure->Measure(FString::Chr(Advance.Key), FontInfo).X;
+		}
+		Glyphs.LineHeight = FontMeasure->GetMaxCharacterHeight(FontInfo);
+	}
+
+	// the glyph tables are read only from here on, so the lines can be summed up in parallel.
+	const int32 NumBatches = FMath::DivideAndRoundUp(NumLines, CreditsLayoutBatchSize);
+	ParallelFor(NumBatches, [&Credits, &Lines, &StyleGlyphs, NumLines](int32 Batch)
+	{
+		const int32 BatchEnd = FMath::Min((Batch + 1) * CreditsLayoutBatchSize, NumLines);
+		for (int32 Line = Batch * CreditsLayoutBatchSize; Line < BatchEnd; ++Line)
+		{
+			if (Lines.Kinds[Line] == ECreditsLineKind::Image)
+			{
+				continue;
+			}
+
+			const uint16 StyleIndex = Lines.StyleIndices[Line];
+			const FCreditsStyleGlyphs& Glyphs = StyleGlyphs[StyleIndex];
+
+			float Width = 0.0f;
+			for (const TCHAR Char : Lines.GetText(Line))
+			{
+				Width += Glyphs.GetAdvance(Char);
+			}
+			Lines.Widths[Line] = Width;
+
+			// the compiler added the padding on top of its estimate, swap the estimate for the measured height.
+			Lines.Heights[Line] += Glyphs.LineHeight - FCreditsCompiler::EstimateTextHeight(Credits.Styles[StyleIndex]);
+		}
+	});
+
+	Lines.bMeasured = true;
+	Lines.UpdateOffsets();
+	return true;
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsLazyCompiler.h"
+#include "Engine/DataTable.h"
+#include "CreditsCompiler.h"
+#include "CreditsConverter.h"
+#include "CreditsLayout.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsStats.h"
+
+/** Returns the estimated height of the lines of a text object, padding included, ignoring its image. */
+template<typename TextObjectType>
+static float EstimateTextObjectHeight(const TextObjectType& Object)
+{
+	return FCreditsCompiler::EstimateTextHeight(FCreditsLineStyle(Object.TextProperties, Object.ImageProperties, Object.Padding)) + Object.Padding.Top + Object.Padding.Bottom;
+}
+
+FCreditsLazyCompiler::FCreditsLazyCompiler(const TArray<FCreditsSectionSimple>& InSections, const TArray<FName>& InSectionKeys, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides)
+	: Sections(InSections)
+	, SectionKeys(InSectionKeys)
+	, Compiled(MakeShared<FCreditsCompiledCredits>())
+	, Overrides(MakeShared<FCreditsOverrideIndex>())
+	, NumMaterialized(0)
+{
+	check(SectionKeys.Num() == Sections.Num());
+	Overrides->Build(SectionOverrides, RoleOverrides, NameOverrides);
+}
+
+FCreditsLazyCompiler::FCreditsLazyCompiler(const UDataTable* SectionsTable, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides)
+	: Compiled(MakeShared<FCreditsCompiledCredits>())
+	, Overrides(MakeShared<FCreditsOverrideIndex>())
+	, NumMaterialized(0)
+{
+	const UScriptStruct* RowStruct = SectionsTable ? SectionsTable->GetRowStruct() : nullptr;
+	if (RowStruct && RowStruct->IsChildOf(FCreditsSectionSimple::StaticStruct()))
+	{
+		for (const TPair<FName, uint8*>& Row : SectionsTable->GetRowMap())
+		{
+			Sections.Add(*reinterpret_cast<const FCreditsSectionSimple*>(Row.Value));
+			SectionKeys.Add(Row.Key);
+		}
+	}
+	else if (SectionsTable)
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsLazyCompiler: %s does not hold FCreditsSectionSimple rows"), *SectionsTable->GetName());
+	}
+	Overrides->Build(SectionOverrides, RoleOverrides, NameOverrides);
+}
+
+void FCreditsLazyCompiler::Start()
+{
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(Credits);
+
+	// the defaults the converter starts every object from, overrides only show once a section is materialized.
+	const FCreditsSectionDefaults SectionDefaults;
+	const FCreditsRoleDefaults RoleDefaults;
+	const FCreditsNameTextObject NameDefaults;
+	const float SectionPadding = SectionDefaults.SectionPadding.Top + SectionDefaults.SectionPadding.Bottom;
+	const float TitleHeight = EstimateTextObjectHeight(SectionDefaults.Title);
+	const float RoleHeight = RoleDefaults.DisplayRoleName && RoleDefaults.RolePosition == ECreditsTextPosition::Top ? EstimateTextObjectHeight(RoleDefaults.Role) : 0.0f;
+	const float NameHeight = EstimateTextObjectHeight(NameDefaults);
+
+	Compiled->Reset();
+	SectionTitles.Reset(Sections.Num());
+	for (const FCreditsSectionSimple& Section : Sections)
+	{
+		float Height = SectionPadding + (Section.Title.Text.IsEmpty() ? 0.0f : TitleHeight);
+		for (const FCreditsRoleStructSimple& Role : Section.Roles)
+		{
+			Height += RoleHeight + Role.PlayedBy.Num() * NameHeight;
+		}
+
+		Compiled->Lines.BeginSection(FCreditsPaddingMargin(0.0f, Height, 0.0f, 0.0f));
+		SectionTitles.Add(FName(*Section.Title.Text));
+	}
+
+	// measures nothing yet, but tells whether the sections are measured once they are materialized.
+	FCreditsLayout::Layout(*Compiled);
+	Compiled->Lines.SectionNames = SectionTitles;
+
+	bMaterialized.Init(false, Sections.Num());
+	NumMaterialized = 0;
+}
+
+FCreditsLazyUpdate FCreditsLazyCompiler::Update(float& Anchor, float Top, float Bottom)
+{
+	check(IsInGameThread());
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsRecompile);
+	LLM_SCOPE_BYTAG(Credits);
+
+	// sections are visited top to bottom and their offsets read again each time, as a materialized one moves those below it.
+	const FCreditsLineTable& Lines = Compiled->Lines;
+	const int32 NumSections = Sections.Num();
+	FCreditsLazyUpdate Result;
+	bool bFreed = false;
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		const float SectionTop = Lines.SectionOffsetsY[SectionIndex];
+		const float SectionBottom = SectionIndex + 1 < NumSections ? Lines.SectionOffsetsY[SectionIndex + 1] : Lines.TotalHeight;
+		const bool bInWindow = SectionBottom > Top && SectionTop < Bottom;
+		if (bInWindow == bMaterialized[SectionIndex])
+		{
+			continue;
+		}
+
+		if (Result.FirstLine == INDEX_NONE)
+		{
+			int32 SectionEnd;
+			Lines.GetSectionRange(SectionIndex, Result.FirstLine, SectionEnd);
+		}
+		if (!bInWindow)
+		{
+			FreeSection(SectionIndex);
+			bFreed = true;
+			continue;
+		}
+
+		MaterializeSection(SectionIndex);
+		Result.MaterializedSections.Add(SectionIndex);
+
+		// a section wholly above the anchor moves it with the lines under it, and the window with it.
+		if (SectionBottom <= Anchor)
+		{
+			const float NewBottom = SectionIndex + 1 < NumSections ? Lines.SectionOffsetsY[SectionIndex + 1] : Lines.TotalHeight;
+			const float Delta = NewBottom - SectionBottom;
+			Anchor += Delta;
+			Top += Delta;
+			Bottom += Delta;
+		}
+	}
+
+	// the styles and images of freed lines are dropped, every line above may then point at new indices.
+	if (bFreed && Compiled->CompactTables(Result.ImageRemap))
+	{
+		Result.FirstLine = 0;
+	}
+	return Result;
+}
+
+void FCreditsLazyCompiler::MaterializeSection(int32 SectionIndex)
+{
+	FCreditsSection Converted;
+	FCreditsConverter::ConvertSection(Sections[SectionIndex], &Overrides.Get(), SectionKeys[SectionIndex], Converted);
+
+	// the section compiles into a table of its own, sharing the styles and images of the credits.
+	FCreditsLineTable SectionLines;
+	Swap(Compiled->Lines, SectionLines);
+	const bool bMeasured = SectionLines.bMeasured;
+	FCreditsCompiler::CompileSection(Converted, *Compiled);
+	if (bMeasured)
+	{
+		FCreditsLayout::Layout(*Compiled);
+	}
+	else
+	{
+		Compiled->Lines.UpdateOffsets();
+	}
+	Swap(Compiled->Lines, SectionLines);
+
+	Compiled->Lines.ReplaceSection(SectionIndex, SectionLines);
+	Compiled->Lines.SectionNames[SectionIndex] = SectionTitles[SectionIndex];
+	bMaterialized[SectionIndex] = true;
+	++NumMaterialized;
+}
+
+void FCreditsLazyCompiler::FreeSection(int32 SectionIndex)
+{
+	FCreditsLineTable& Lines = Compiled->Lines;
+	const float SectionBottom = SectionIndex + 1 < Lines.SectionOffsetsY.Num() ? Lines.SectionOffsetsY[SectionIndex + 1] : Lines.TotalHeight;
+
+	// the styles and images of the freed lines are left to the compaction at the end of the update.
+	FCreditsLineTable Placeholder;
+	Placeholder.BeginSection(FCreditsPaddingMargin(0.0f, SectionBottom - Lines.SectionOffsetsY[SectionIndex], 0.0f, 0.0f));
+	Placeholder.UpdateOffsets();
+
+	Lines.ReplaceSection(SectionIndex, Placeholder);
+	Lines.SectionNames[SectionIndex] = SectionTitles[SectionIndex];
+	bMaterialized[SectionIndex] = false;
+	--NumMaterialized;
+}
+
+void FCreditsLazyCompiler::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FCreditsSectionSimple& Section : Sections)
+	{
+		Section.Title.ImageProperties.AddReferencedObjects(Collector);
+		for (FCreditsRoleStructSimple& Role : Section.Roles)
+		{
+			Role.Role.ImageProperties.AddReferencedObjects(Collector);
+			for (FCreditsTextObjectSimple& Name : Role.PlayedBy)
+			{
+				Name.ImageProperties.AddReferencedObjects(Collector);
+			}
+		}
+	}
+}
+
+FString FCreditsLazyCompiler::GetReferencerName() const
+{
+	return TEXT("FCreditsLazyCompiler");
+}
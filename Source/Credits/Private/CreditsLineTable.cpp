@@ -0,0 +1,275 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsLineTable.h"
+#include "Algo/BinarySearch.h"
+
+int32 FCreditsLineTable::AddLine(ECreditsLineKind Kind, FStringView Text, uint16 StyleIndex, int32 ImageIndex, float Width, float Height, uint8 LineFlags)
+{
+	TextStarts.Add(StringPool.Len());
+	TextLengths.Add(Text.Len());
+	StringPool.AppendChars(Text.GetData(), Text.Len());
+	StyleIndices.Add(StyleIndex);
+	ImageIndices.Add(ImageIndex);
+	OffsetsY.Add(0.0f);
+	Widths.Add(Width);
+	Heights.Add(Height);
+	Flags.Add(LineFlags);
+	return Kinds.Add(Kind);
+}
+
+void FCreditsLineTable::BeginSection(const FCreditsPaddingMargin& SectionPadding)
+{
+	SectionStarts.Add(Num());
+	SectionPaddingTop.Add(SectionPadding.Top);
+	SectionPaddingBottom.Add(SectionPadding.Bottom);
+}
+
+void FCreditsLineTable::UpdateOffsets()
+{
+	float Cursor = 0.0f;
+	const int32 NumSections = SectionStarts.Num();
+	int32 Line = 0;
+
+	// side roles share their row with their names, so the names advance and the row ends below the taller column,
+	// a side role without names still taking its own height. SideBottom is negative while no row is open.
+	float SideBottom = -1.0f;
+	const auto CloseRow = [&Cursor, &SideBottom]()
+	{
+		Cursor = FMath::Max(Cursor, SideBottom);
+		SideBottom = -1.0f;
+	};
+	const auto PlaceLine = [this, &Cursor, &SideBottom, &CloseRow](int32 InLine)
+	{
+		if (Flags[InLine] & ECreditsLineFlags::SideColumn)
+		{
+			// every side line starts a row, so the text of a side role sits below its image and beside its names.
+			CloseRow();
+			OffsetsY[InLine] = Cursor;
+			SideBottom = FMath::Max(SideBottom, Cursor + Heights[InLine]);
+			return;
+		}
+
+		if (!(Flags[InLine] & ECreditsLineFlags::NameColumn))
+		{
+			CloseRow();
+		}
+		OffsetsY[InLine] = Cursor;
+		Cursor += Heights[InLine];
+	};
+
+	// lines added before the first section are laid out without section padding.
+	const int32 FirstSectionStart = NumSections > 0 ? SectionStarts[0] : Num();
+	for (; Line < FirstSectionStart; ++Line)
+	{
+		PlaceLine(Line);
+	}
+	CloseRow();
+
+	SectionOffsetsY.SetNumUninitialized(NumSections);
+	SectionNames.Init(NAME_None, NumSections);
+	for (int32 Section = 0; Section < NumSections; ++Section)
+	{
+		const int32 SectionEnd = Section + 1 < NumSections ? SectionStarts[Section + 1] : Num();
+
+		SectionOffsetsY[Section] = Cursor;
+		Cursor += SectionPaddingTop[Section];
+		for (; Line < SectionEnd; ++Line)
+		{
+			PlaceLine(Line);
+
+			if (Kinds[Line] == ECreditsLineKind::SectionTitle && SectionNames[Section].IsNone())
+			{
+				SectionNames[Section] = FName(TextLengths[Line], *StringPool + TextStarts[Line]);
+			}
+		}
+		CloseRow();
+		Cursor += SectionPaddingBottom[Section];
+	}
+
+	TotalHeight = Cursor;
+}
+
+/** Overwrites the OldCount items of Array at First with the items of Source, growing or shrinking the array in place. */
+template<typename ItemType>
+static void SpliceLines(TArray<ItemType>& Array, int32 First, int32 OldCount, const TArray<ItemType>& Source)
+{
+	const int32 NewCount = Source.Num();
+	if (NewCount > OldCount)
+	{
+		Array.InsertUninitialized(First + OldCount, NewCount - OldCount);
+	}
+	else if (NewCount < OldCount)
+	{
+		Array.RemoveAt(First + NewCount, OldCount - NewCount, false);
+	}
+	FMemory::Memcpy(Array.GetData() + First, Source.GetData(), NewCount * sizeof(ItemType));
+}
+
+void FCreditsLineTable::ReplaceSection(int32 Section, const FCreditsLineTable& Source)
+{
+	check(Source.SectionStarts.Num() == 1 && Source.SectionStarts[0] == 0);
+
+	int32 First;
+	int32 End;
+	GetSectionRange(Section, First, End);
+	const int32 OldCount = End - First;
+	const int32 NewCount = Source.Num();
+	const int32 PoolStart = StringPool.Len();
+	const float OldBottom = Section + 1 < SectionStarts.Num() ? SectionOffsetsY[Section + 1] : TotalHeight;
+
+	StringPool += Source.StringPool;
+	SpliceLines(TextStarts, First, OldCount, Source.TextStarts);
+	SpliceLines(TextLengths, First, OldCount, Source.TextLengths);
+	SpliceLines(StyleIndices, First, OldCount, Source.StyleIndices);
+	SpliceLines(ImageIndices, First, OldCount, Source.ImageIndices);
+	SpliceLines(OffsetsY, First, OldCount, Source.OffsetsY);
+	SpliceLines(Widths, First, OldCount, Source.Widths);
+	SpliceLines(Heights, First, OldCount, Source.Heights);
+	SpliceLines(Kinds, First, OldCount, Source.Kinds);
+	SpliceLines(Flags, First, OldCount, Source.Flags);
+
+	for (int32 Line = First; Line < First + NewCount; ++Line)
+	{
+		TextStarts[Line] += PoolStart;
+	}
+	for (int32 Later = Section + 1; Later < SectionStarts.Num(); ++Later)
+	{
+		SectionStarts[Later] += NewCount - OldCount;
+	}
+	SectionPaddingTop[Section] = Source.SectionPaddingTop[0];
+	SectionPaddingBottom[Section] = Source.SectionPaddingBottom[0];
+	SectionNames[Section] = Source.SectionNames[0];
+
+	// Source was laid out from 0, only its lines move down to the section, the rest shifts by the height change.
+	const float SectionTop = SectionOffsetsY[Section];
+	for (int32 Line = First; Line < First + NewCount; ++Line)
+	{
+		OffsetsY[Line] += SectionTop;
+	}
+	const float HeightDelta = SectionTop + Source.TotalHeight - OldBottom;
+	if (HeightDelta != 0.0f)
+	{
+		for (int32 Line = First + NewCount; Line < Num(); ++Line)
+		{
+			OffsetsY[Line] += HeightDelta;
+		}
+		for (int32 Later = Section + 1; Later < SectionStarts.Num(); ++Later)
+		{
+			SectionOffsetsY[Later] += HeightDelta;
+		}
+		TotalHeight += HeightDelta;
+	}
+
+	int32 NumUsedChars = 0;
+	for (const int32 Length : TextLengths)
+	{
+		NumUsedChars += Length;
+	}
+	if (NumUsedChars < StringPool.Len() / 2)
+	{
+		CompactStringPool();
+	}
+}
+
+void FCreditsLineTable::CompactStringPool()
+{
+	FString Compacted;
+	Compacted.Reserve(StringPool.Len());
+	for (int32 Line = 0; Line < Num(); ++Line)
+	{
+		const int32 Start = Compacted.Len();
+		Compacted.AppendChars(*StringPool + TextStarts[Line], TextLengths[Line]);
+		TextStarts[Line] = Start;
+	}
+	StringPool = MoveTemp(Compacted);
+}
+
+int32 FCreditsLineTable::FindSection(const FName& Name) const
+{
+	return SectionNames.IndexOfByKey(Name);
+}
+
+int32 FCreditsLineTable::FindSectionOfLine(int32 Line) const
+{
+	// SectionStarts never decreases, the section is the last one starting at or before Line.
+	return FMath::Max(0, Algo::UpperBound(SectionStarts, Line) - 1);
+}
+
+void FCreditsLineTable::FindLineRange(float Top, float Bottom, int32& OutFirst, int32& OutEnd) const
+{
+	// OffsetsY never decreases, so both ends are a binary search away.
+	OutFirst = Algo::UpperBound(OffsetsY, Top);
+	OutEnd = Algo::LowerBound(OffsetsY, Bottom);
+
+	// the lines starting above Top may still reach into the range, side roles share their row so walk back over them.
+	while (OutFirst > 0 && OffsetsY[OutFirst - 1] + Heights[OutFirst - 1] > Top)
+	{
+		--OutFirst;
+	}
+
+	// a side line ends with the taller column of its row, so it may still reach into the range above names that do not.
+	int32 RowStart = OutFirst;
+	while (RowStart > 0 && (Flags[RowStart - 1] & ECreditsLineFlags::NameColumn))
+	{
+		--RowStart;
+	}
+	if (RowStart > 0 && (Flags[RowStart - 1] & ECreditsLineFlags::SideColumn) && OffsetsY[RowStart - 1] + Heights[RowStart - 1] > Top)
+	{
+		OutFirst = RowStart - 1;
+	}
+	OutEnd = FMath::Max(OutFirst, OutEnd);
+}
+
+void FCreditsLineTable::Reserve(int32 NumLines, int32 NumChars)
+{
+	StringPool.Reserve(NumChars);
+	TextStarts.Reserve(NumLines);
+	TextLengths.Reserve(NumLines);
+	StyleIndices.Reserve(NumLines);
+	ImageIndices.Reserve(NumLines);
+	OffsetsY.Reserve(NumLines);
+	Widths.Reserve(NumLines);
+	Heights.Reserve(NumLines);
+	Kinds.Reserve(NumLines);
+	Flags.Reserve(NumLines);
+}
+
+void FCreditsLineTable::Reset()
+{
+	StringPool.Reset();
+	TextStarts.Reset();
+	TextLengths.Reset();
+	StyleIndices.Reset();
+	ImageIndices.Reset();
+	OffsetsY.Reset();
+	Widths.Reset();
+	Heights.Reset();
+	Kinds.Reset();
+	Flags.Reset();
+	SectionStarts.Reset();
+	SectionPaddingTop.Reset();
+	SectionPaddingBottom.Reset();
+	SectionOffsetsY.Reset();
+	SectionNames.Reset();
+	TotalHeight = 0.0f;
+	bMeasured = false;
+}
+
+SIZE_T FCreditsLineTable::GetAllocatedSize() const
+{
+	return StringPool.GetAllocatedSize()
+		+ TextStarts.GetAllocatedSize()
+		+ TextLengths.GetAllocatedSize()
+		+ StyleIndices.GetAllocatedSize()
+		+ ImageIndices.GetAllocatedSize()
+		+ OffsetsY.GetAllocatedSize()
+		+ Widths.GetAllocatedSize()
+		+ Heights.GetAllocatedSize()
+		+ Kinds.GetAllocatedSize()
+		+ Flags.GetAllocatedSize()
+		+ SectionStarts.GetAllocatedSize()
+		+ SectionPaddingTop.GetAllocatedSize()
+		+ SectionPaddingBottom.GetAllocatedSize()
+		+ SectionOffsetsY.GetAllocatedSize()
+		+ SectionNames.GetAllocatedSize();
+}
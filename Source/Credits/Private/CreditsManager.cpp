@@ -1,6 +1,7 @@
 // Copyright (c) 2019 - 2020 Dazzle Software, LLC. All Rights Reserved.
 
 #include "CreditsManager.h"
+#include "UObject/GCObject.h"
 
 FCreditsTextProperties::FCreditsTextProperties(const FString InTitle, UFont* InFont, UMaterialInterface* InFontMaterial, int InFontSize, const FLinearColor& InColor)
 {
@@ -11,13 +12,25 @@ FCreditsTextProperties::FCreditsTextProperties(const FString InTitle, UFont* InF
 	Color = InColor;
 }
 
-FCreditsImageProperties::FCreditsImageProperties(UTexture2D* InImage, bool InImageSizeOverride, FVector2D InImageSizeProperties)
+void FCreditsTextProperties::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Font);
+	Collector.AddReferencedObject(FontMaterial);
+}
+
+FCreditsImageProperties::FCreditsImageProperties(UTexture2D* InImage, bool InImageSizeOverride, FVector2D InImageSizeProperties, const TSoftObjectPtr<UTexture2D>& InSoftImage)
 {
 	Image = InImage;
+	SoftImage = InSoftImage;
 	ImageSizeOverride = InImageSizeOverride;
 	ImageSizeProperties = InImageSizeProperties;
 }
 
+void FCreditsImageProperties::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Image);
+}
+
 FCreditsPaddingMargin::FCreditsPaddingMargin(float InLeft, float InTop, float InRight, float InBottom)
 {
 	Left = InLeft;
@@ -33,6 +46,12 @@ FCreditsTextObject::FCreditsTextObject(const FCreditsTextProperties& InTextPrope
 	Padding = InPadding;
 }
 
+void FCreditsTextObject::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	TextProperties.AddReferencedObjects(Collector);
+	ImageProperties.AddReferencedObjects(Collector);
+}
+
 FCreditsRoleDefaults::FCreditsRoleDefaults(const FCreditsTextObject& InRole, const ECreditsTextPosition& InRolePosition, bool InDisplayRoleName)
 {
 	Role = InRole;
@@ -40,6 +59,11 @@ FCreditsRoleDefaults::FCreditsRoleDefaults(const FCreditsTextObject& InRole, con
 	DisplayRoleName = InDisplayRoleName;
 }
 
+void FCreditsRoleDefaults::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Role.AddReferencedObjects(Collector);
+}
+
 FCreditsSectionDefaults::FCreditsSectionDefaults(const FCreditsTextObject& InTitle, const ECreditsStartingPosition& InTitlePosition, const FCreditsPaddingMargin& InSectionPadding)
 {
 	Title = InTitle;
@@ -47,6 +71,11 @@ FCreditsSectionDefaults::FCreditsSectionDefaults(const FCreditsTextObject& InTit
 	SectionPadding = InSectionPadding;
 }
 
+void FCreditsSectionDefaults::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Title.AddReferencedObjects(Collector);
+}
+
 FCreditsGeneralSettings::FCreditsGeneralSettings(UCurveFloat* InSpeedCurve, UCurveFloat* InOpacityCurve, UCurveFloat* InVolumeCurve, const ECreditsStartingPosition& InCreditsStartingPosition, bool InTimeDilationEffectsCredits, bool InAutoPlayMusic, bool InRestartMusicAtEnd, bool InEndCreditsOnEndReached, bool InStopMusicOnCreditsEnded, bool InStopQueueingMusicWhenCreditsEnded)
 {
 	SpeedCurve = InSpeedCurve;
@@ -68,6 +97,12 @@ FCreditsNameTextObject::FCreditsNameTextObject(const FCreditsTextProperties& InT
 	Padding = InPadding;
 }
 
+void FCreditsNameTextObject::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	TextProperties.AddReferencedObjects(Collector);
+	ImageProperties.AddReferencedObjects(Collector);
+}
+
 FCreditsMusic::FCreditsMusic(USoundWave* InAudio, const ECreditsSoundQueueMode& InQueueMode, float InStartTime, float InPlayDelay)
 {
 	Audio = InAudio;
@@ -96,18 +131,32 @@ FCreditsNameOverrides::FCreditsNameOverrides(const FName& InParentSection, const
 	OverrideData = InOverrideData;
 }
 
-FCreditsOverrides::FCreditsOverrides(const FCreditsSectionOverride& InSectionOverride, bool InOverridingSection, TArray<FCreditsRoleOverride>& InRoleOverrides, TArray<FCreditsNameOverrides>& InNameOverrides)
+FCreditsOverrides::FCreditsOverrides(const FCreditsSectionOverride& InSectionOverride, bool InOverridingSection, const TArray<FCreditsRoleOverride>& InRoleOverrides, const TArray<FCreditsNameOverrides>& InNameOverrides)
+	: SectionOverride(InSectionOverride)
+	, IsOverridingSection(InOverridingSection)
+	, RoleOverrides(InRoleOverrides)
+	, NameOverrides(InNameOverrides)
+{
+}
+
+FCreditsOverrides::FCreditsOverrides(FCreditsSectionOverride&& InSectionOverride, bool InOverridingSection, TArray<FCreditsRoleOverride>&& InRoleOverrides, TArray<FCreditsNameOverrides>&& InNameOverrides)
+	: SectionOverride(MoveTemp(InSectionOverride))
+	, IsOverridingSection(InOverridingSection)
+	, RoleOverrides(MoveTemp(InRoleOverrides))
+	, NameOverrides(MoveTemp(InNameOverrides))
 {
-	SectionOverride = InSectionOverride;
-	IsOverridingSection = InOverridingSection;
-	RoleOverrides = InRoleOverrides;
-	NameOverrides = InNameOverrides;
 }
 
 FCreditsRole::FCreditsRole(const FCreditsRoleDefaults& InRoleProperties, const TArray<FCreditsNameTextObject>& InPlayedByNames)
+	: RoleProperties(InRoleProperties)
+	, PlayedByNames(InPlayedByNames)
+{
+}
+
+FCreditsRole::FCreditsRole(FCreditsRoleDefaults&& InRoleProperties, TArray<FCreditsNameTextObject>&& InPlayedByNames)
+	: RoleProperties(MoveTemp(InRoleProperties))
+	, PlayedByNames(MoveTemp(InPlayedByNames))
 {
-	RoleProperties = InRoleProperties;
-	PlayedByNames = InPlayedByNames;
 }
 
 FCreditsTextObjectSimple::FCreditsTextObjectSimple(const FString& InText, const FCreditsImageProperties& InImageProperties)
@@ -116,21 +165,66 @@ FCreditsTextObjectSimple::FCreditsTextObjectSimple(const FString& InText, const
 	ImageProperties = InImageProperties;
 }
 
-FCreditsRoleStructSimple::FCreditsRoleStructSimple(const FCreditsTextObjectSimple& InRole, bool InDisplayRoleName, TArray<FCreditsTextObjectSimple>& InPlayedBy)
+FCreditsRoleStructSimple::FCreditsRoleStructSimple(const FCreditsTextObjectSimple& InRole, bool InDisplayRoleName, const TArray<FCreditsTextObjectSimple>& InPlayedBy)
+	: Role(InRole)
+	, DisplayRoleName(InDisplayRoleName)
+	, PlayedBy(InPlayedBy)
+{
+}
+
+FCreditsRoleStructSimple::FCreditsRoleStructSimple(FCreditsTextObjectSimple&& InRole, bool InDisplayRoleName, TArray<FCreditsTextObjectSimple>&& InPlayedBy)
+	: Role(MoveTemp(InRole))
+	, DisplayRoleName(InDisplayRoleName)
+	, PlayedBy(MoveTemp(InPlayedBy))
 {
-	Role = InRole;
-	DisplayRoleName = InDisplayRoleName;
-	PlayedBy = InPlayedBy;
 }
 
 FCreditsSection::FCreditsSection(const FCreditsSectionDefaults& InSectionProperties, const TArray<FCreditsRole>& InRoles)
+	: SectionProperties(InSectionProperties)
+	, Roles(InRoles)
+{
+}
+
+FCreditsSection::FCreditsSection(FCreditsSectionDefaults&& InSectionProperties, TArray<FCreditsRole>&& InRoles)
+	: SectionProperties(MoveTemp(InSectionProperties))
+	, Roles(MoveTemp(InRoles))
 {
-	SectionProperties = InSectionProperties;
-	Roles = InRoles;
 }
 
 FCreditsSectionSimple::FCreditsSectionSimple(const FCreditsTextObjectSimple& InTitle, const TArray<FCreditsRoleStructSimple>& InRoles)
+	: Title(InTitle)
+	, Roles(InRoles)
 {
-	Title = InTitle;
-	Roles = InRoles;
+}
+
+FCreditsSectionSimple::FCreditsSectionSimple(FCreditsTextObjectSimple&& InTitle, TArray<FCreditsRoleStructSimple>&& InRoles)
+	: Title(MoveTemp(InTitle))
+	, Roles(MoveTemp(InRoles))
+{
+}
+
+FOnCreditsRowChanged& OnCreditsRowChanged()
+{
+	static FOnCreditsRowChanged RowChanged;
+	return RowChanged;
+}
+
+void FCreditsSectionOverride::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+	OnCreditsRowChanged().Broadcast(InDataTable, InRowName);
+}
+
+void FCreditsRoleOverride::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+	OnCreditsRowChanged().Broadcast(InDataTable, InRowName);
+}
+
+void FCreditsNameOverrides::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+	OnCreditsRowChanged().Broadcast(InDataTable, InRowName);
+}
+
+void FCreditsSectionSimple::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+	OnCreditsRowChanged().Broadcast(InDataTable, InRowName);
 }
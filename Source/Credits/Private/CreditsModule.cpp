@@ -2,6 +2,8 @@
 
 #include "CreditsModule.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "CreditsDefaultAssets.h"
 #include "CreditsManager.h"
 
 /**
@@ -17,6 +19,9 @@ public:
 	virtual void StartupModule() override
 	{
 		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsModule::StartupModule"));
+
+		// the module loads before the engine, so resolve the shared default assets once it is up.
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&FCreditsDefaultAssets::Resolve);
 	}
 
 	/**
@@ -25,7 +30,15 @@ public:
 	virtual void ShutdownModule() override
 	{
 		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsModule::ShutdownModule"));
+
+		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+		FCreditsDefaultAssets::Release();
 	}
+
+private:
+
+	/** handle to the post engine init binding that resolves the default assets. */
+	FDelegateHandle PostEngineInitHandle;
 };
 
 //IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Credits, "Credits" );
@@ -0,0 +1,325 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsMusic.h"
+#include "AudioDevice.h"
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Quartz/QuartzSubsystem.h"
+#include "Sound/QuartzQuantizationUtilities.h"
+#include "Sound/SoundWave.h"
+#include "CreditsStats.h"
+
+const float FCreditsMusicQueue::DefaultLookahead = 2.0f;
+const float FCreditsMusicQueue::TicksPerSecond = 1000.0f;
+
+const double FCreditsPlaybackClock::MaxSlewRate = 0.05;
+const double FCreditsPlaybackClock::SlewSeconds = 0.5;
+const double FCreditsPlaybackClock::SnapSeconds = 0.25;
+
+/** Seconds between Play Track and the start of the track, enough for it to be scheduled ahead of the renderer. */
+static const double CreditsMusicPrerollSeconds = 0.1;
+
+FCreditsMusicTrack::FCreditsMusicTrack(const FCreditsMusic& Music)
+	: Audio(Music.Audio)
+	, QueueMode(Music.QueueMode)
+	, StartTime(Music.StartTime)
+	, PlayDelay(Music.PlayDelay)
+	, Begin(-1.0)
+	, Duration(0.0)
+	, StartTick(-1.0)
+{
+}
+
+void FCreditsPlaybackClock::Advance(double DeltaTime)
+{
+	// the correction is proportional to the error so the clock settles on the audio without overshooting it.
+	const double Correction = FMath::Clamp(Error / SlewSeconds, -MaxSlewRate, MaxSlewRate) * DeltaTime;
+	const double Step = FMath::Abs(Correction) < FMath::Abs(Error) ? Correction : Error;
+	Time += DeltaTime + Step;
+	Error -= Step;
+}
+
+void FCreditsPlaybackClock::Sync(double AudioTime)
+{
+	Error = AudioTime - Time;
+	if (FMath::Abs(Error) > SnapSeconds)
+	{
+		Reset(AudioTime);
+	}
+}
+
+FCreditsMusicQueue::FCreditsMusicQueue()
+	: Clock(nullptr)
+	, NextTrack(0)
+	, ScheduledEnd(0.0)
+	, Volume(1.0f)
+	, bLoop(false)
+	, bQueueing(false)
+{
+}
+
+FCreditsMusicQueue::~FCreditsMusicQueue()
+{
+	Stop();
+}
+
+void FCreditsMusicQueue::Start(UWorld* InWorld, const TArray<FCreditsMusic>& Music, bool bInLoop, bool bAutoPlay)
+{
+	Stop();
+	if (InWorld == nullptr)
+	{
+		return;
+	}
+
+	World = InWorld;
+	bLoop = bInLoop;
+	Playback.Reset(0.0);
+	NextTrack = 0;
+
+	Tracks.Reset(Music.Num());
+	for (const FCreditsMusic& Row : Music)
+	{
+		Tracks.Emplace(Row);
+	}
+
+	// the transport of the clock is the queue clock, a tick every millisecond from the start.
+	UQuartzSubsystem* Quartz = UQuartzSubsystem::Get(InWorld);
+	if (Quartz == nullptr)
+	{
+		return;
+	}
+
+	static int32 ClockCounter = 0;
+	FQuartzClockSettings ClockSettings;
+	Clock = Quartz->CreateNewClock(InWorld, FName(TEXT("CreditsMusic"), ++ClockCounter), ClockSettings, true);
+	if (Clock == nullptr)
+	{
+		return;
+	}
+	Clock->SetTicksPerSecond(InWorld, FQuartzQuantizationBoundary(EQuartzCommandQuantization::None), FOnQuartzCommandEventBP(), Clock, TicksPerSecond);
+	Clock->StartClock(InWorld, Clock);
+	if (!bAutoPlay)
+	{
+		return;
+	}
+
+	ScheduledEnd = LayOutTracks(Tracks, 0, CreditsMusicPrerollSeconds);
+	bQueueing = true;
+	Update(0.0f);
+}
+
+void FCreditsMusicQueue::Update(float DeltaTime)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsScheduleMusic);
+	LLM_SCOPE_BYTAG(Credits);
+
+	Playback.Advance(DeltaTime);
+	const double QueueTime = Playback.GetTime();
+	for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+	{
+		if (!IsValid(Components[Index]) || ComponentEnds[Index] < QueueTime)
+		{
+			if (IsValid(Components[Index]))
+			{
+				Components[Index]->OnAudioPlaybackPercentNative.RemoveAll(this);
+			}
+			Components.RemoveAtSwap(Index);
+			ComponentEnds.RemoveAtSwap(Index);
+			ComponentOrigins.RemoveAtSwap(Index);
+		}
+	}
+
+	if (!bQueueing || !World.IsValid())
+	{
+		return;
+	}
+
+	while (NextTrack < Tracks.Num())
+	{
+		const FCreditsMusicTrack& Track = Tracks[NextTrack];
+		if (Track.QueueMode == ECreditsSoundQueueMode::SkipAudio || Track.Audio == nullptr)
+		{
+			++NextTrack;
+			continue;
+		}
+
+		// a track waiting on Play Track holds back the ones after it, and nothing is left to queue until it is played.
+		if (!Track.IsQueued())
+		{
+			bQueueing = false;
+			return;
+		}
+		if (Track.Begin > Playback.GetTime() + DefaultLookahead)
+		{
+			return;
+		}
+
+		ScheduleTrack(NextTrack);
+		++NextTrack;
+	}
+
+	// the next pass over the music starts where the last track of this one ends.
+	if (bLoop)
+	{
+		for (FCreditsMusicTrack& Track : Tracks)
+		{
+			Track.Begin = -1.0;
+			Track.StartTick = -1.0;
+		}
+		NextTrack = 0;
+		const double PassBegin = ScheduledEnd;
+		ScheduledEnd = LayOutTracks(Tracks, 0, PassBegin);
+		bQueueing = ScheduledEnd > PassBegin;
+	}
+	else
+	{
+		bQueueing = false;
+	}
+}
+
+void FCreditsMusicQueue::PlayTrack(int32 Index)
+{
+	if (!Tracks.IsValidIndex(Index) || !World.IsValid() || Clock == nullptr)
+	{
+		return;
+	}
+
+	// the tracks scheduled after the new one are left to play, the queue carries on from it.
+	ScheduledEnd = LayOutTracks(Tracks, Index, Playback.GetTime() + CreditsMusicPrerollSeconds);
+	NextTrack = Index;
+	bQueueing = true;
+	Update(0.0f);
+}
+
+void FCreditsMusicQueue::StopQueueing()
+{
+	bQueueing = false;
+}
+
+void FCreditsMusicQueue::Stop()
+{
+	bQueueing = false;
+	for (UAudioComponent* Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Component->OnAudioPlaybackPercentNative.RemoveAll(this);
+			Component->Stop();
+		}
+	}
+	Components.Reset();
+	ComponentEnds.Reset();
+	ComponentOrigins.Reset();
+
+	UWorld* PinnedWorld = World.Get();
+	if (Clock && PinnedWorld)
+	{
+		Clock->StopClock(PinnedWorld, true, Clock);
+		if (UQuartzSubsystem* Quartz = UQuartzSubsystem::Get(PinnedWorld))
+		{
+			Quartz->DeleteClockByHandle(PinnedWorld, Clock);
+		}
+	}
+	Clock = nullptr;
+}
+
+void FCreditsMusicQueue::SetVolume(float InVolume)
+{
+	if (Volume == InVolume)
+	{
+		return;
+	}
+
+	Volume = InVolume;
+	for (UAudioComponent* Component : Components)
+	{
+		if (IsValid(Component))
+		{
+			Component->SetVolumeMultiplier(Volume);
+		}
+	}
+}
+
+double FCreditsMusicQueue::LayOutTracks(TArray<FCreditsMusicTrack>& Tracks, int32 First, double Begin)
+{
+	double Cursor = Begin;
+	for (int32 Index = First; Index < Tracks.Num(); ++Index)
+	{
+		FCreditsMusicTrack& Track = Tracks[Index];
+		if (Track.QueueMode == ECreditsSoundQueueMode::SkipAudio || Track.Audio == nullptr)
+		{
+			continue;
+		}
+		if (Index != First && Track.QueueMode == ECreditsSoundQueueMode::DoNotAutoQueue)
+		{
+			break;
+		}
+
+		Track.Begin = Cursor + Track.PlayDelay;
+		Track.Duration = FMath::Max(0.0, (double)Track.Audio->GetDuration() - Track.StartTime);
+		Cursor = Track.GetEnd();
+	}
+	return Cursor;
+}
+
+void FCreditsMusicQueue::ScheduleTrack(int32 Index)
+{
+	FCreditsMusicTrack& Track = Tracks[Index];
+	UWorld* PinnedWorld = World.Get();
+
+	// a transport relative boundary of N ticks falls on the Nth tick since the clock started, wherever the game
+	// frame is, so each track starts on the tick its predecessor ends on. One already late starts on the next tick.
+	const double BeginTick = FMath::FloorToDouble(Track.Begin * TicksPerSecond);
+	const double NowTick = Playback.GetTime() * TicksPerSecond;
+	const bool bOnTime = BeginTick > NowTick;
+	Track.StartTick = bOnTime ? BeginTick : FMath::FloorToDouble(NowTick) + 1.0;
+
+	// decoding the start of the wave now keeps the first buffer of the track from waiting on the decoder.
+	if (FAudioDevice* AudioDevice = PinnedWorld->GetAudioDeviceRaw())
+	{
+		AudioDevice->Precache(Track.Audio, false, true, false);
+	}
+
+	UAudioComponent* Component = UGameplayStatics::CreateSound2D(PinnedWorld, Track.Audio, Volume, 1.0f, 0.0f, nullptr, false, true);
+	if (Component == nullptr || Clock == nullptr)
+	{
+		return;
+	}
+	Components.Add(Component);
+	ComponentEnds.Add(Track.GetEnd());
+	ComponentOrigins.Add(Track.Begin - Track.StartTime);
+
+	// the component only reports its playback percent when a delegate is bound before it plays.
+	Component->OnAudioPlaybackPercentNative.AddRaw(this, &FCreditsMusicQueue::HandlePlaybackPercent);
+
+	FQuartzQuantizationBoundary Boundary = bOnTime
+		? FQuartzQuantizationBoundary(EQuartzCommandQuantization::Tick, (float)BeginTick, EQuarztQuantizationReference::TransportRelative)
+		: FQuartzQuantizationBoundary(EQuartzCommandQuantization::Tick, 1.0f, EQuarztQuantizationReference::CurrentTimeRelative);
+	Component->PlayQuantized(PinnedWorld, Clock, Boundary, FOnQuartzCommandEventBP(), Track.StartTime);
+}
+
+void FCreditsMusicQueue::HandlePlaybackPercent(const UAudioComponent* Component, const USoundWave* Wave, const float Percent)
+{
+	// the percent is of the whole wave, so the seconds played include the start time the track was played from.
+	const int32 Index = Components.IndexOfByKey(Component);
+	if (Index != INDEX_NONE && Wave)
+	{
+		Playback.Sync(ComponentOrigins[Index] + Percent * Wave->GetDuration());
+	}
+}
+
+void FCreditsMusicQueue::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Clock);
+	for (FCreditsMusicTrack& Track : Tracks)
+	{
+		Collector.AddReferencedObject(Track.Audio);
+	}
+	Collector.AddReferencedObjects(Components);
+}
+
+FString FCreditsMusicQueue::GetReferencerName() const
+{
+	return TEXT("FCreditsMusicQueue");
+}
@@ -0,0 +1,283 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsOverrideIndex.h"
+#include "CreditsModule.h"
+
+/** Visits every row of Table when its row struct matches RowType. */
+template<typename RowType, typename FunctorType>
+static void ForEachCreditsOverrideRow(const UDataTable* Table, FunctorType&& Functor)
+{
+	if (!Table)
+	{
+		return;
+	}
+
+	const UScriptStruct* RowStruct = Table->GetRowStruct();
+	if (!RowStruct || !RowStruct->IsChildOf(RowType::StaticStruct()))
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsOverrideIndex: %s does not use %s rows, skipping it."), *Table->GetName(), *RowType::StaticStruct()->GetName());
+		return;
+	}
+
+	for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+	{
+		Functor(Row.Key, *reinterpret_cast<const RowType*>(Row.Value));
+	}
+}
+
+/** Adds to OutKeys every key of A or B whose value is missing from the other or differs. */
+template<typename KeyType, typename ValueType, typename MakeKeyType>
+static void GetChangedCreditsOverrideKeys(const TMap<KeyType, ValueType>& A, const TMap<KeyType, ValueType>& B, MakeKeyType&& MakeKey, TArray<FCreditsOverrideKey>& OutKeys)
+{
+	for (const TPair<KeyType, ValueType>& Pair : A)
+	{
+		const ValueType* Other = B.Find(Pair.Key);
+		if (!Other || !ValueType::StaticStruct()->CompareScriptStruct(&Pair.Value, Other, PPF_None))
+		{
+			OutKeys.Add(MakeKey(Pair.Key));
+		}
+	}
+	for (const TPair<KeyType, ValueType>& Pair : B)
+	{
+		if (!A.Contains(Pair.Key))
+		{
+			OutKeys.Add(MakeKey(Pair.Key));
+		}
+	}
+}
+
+void FCreditsOverrideIndex::Build(const UDataTable* InSectionOverrides, const UDataTable* InRoleOverrides, const UDataTable* InNameOverrides)
+{
+	Reset();
+
+	SectionOverrides.Reserve(InSectionOverrides ? InSectionOverrides->GetRowMap().Num() : 0);
+	RoleOverrides.Reserve(InRoleOverrides ? InRoleOverrides->GetRowMap().Num() : 0);
+	NameOverrides.Reserve(InNameOverrides ? InNameOverrides->GetRowMap().Num() : 0);
+
+	// section overrides are keyed on their row name, which matches the CreditsData row of the section.
+	ForEachCreditsOverrideRow<FCreditsSectionOverride>(InSectionOverrides, [this](const FName& RowName, const FCreditsSectionOverride& Row)
+	{
+		AddSectionOverride(RowName, Row.OverrideData);
+	});
+
+	ForEachCreditsOverrideRow<FCreditsRoleOverride>(InRoleOverrides, [this](const FName& RowName, const FCreditsRoleOverride& Row)
+	{
+		AddRoleOverride(Row);
+	});
+
+	ForEachCreditsOverrideRow<FCreditsNameOverrides>(InNameOverrides, [this](const FName& RowName, const FCreditsNameOverrides& Row)
+	{
+		AddNameOverride(Row);
+	});
+}
+
+void FCreditsOverrideIndex::Build(const TArray<FCreditsRoleOverride>& InRoleOverrides, const TArray<FCreditsNameOverrides>& InNameOverrides)
+{
+	Reset();
+
+	RoleOverrides.Reserve(InRoleOverrides.Num());
+	NameOverrides.Reserve(InNameOverrides.Num());
+
+	for (const FCreditsRoleOverride& Override : InRoleOverrides)
+	{
+		AddRoleOverride(Override);
+	}
+
+	for (const FCreditsNameOverrides& Override : InNameOverrides)
+	{
+		AddNameOverride(Override);
+	}
+}
+
+void FCreditsOverrideIndex::AddSectionOverride(const FName& Section, const FCreditsSectionDefaults& OverrideData)
+{
+	SectionOverrides.Add(Section, OverrideData);
+}
+
+void FCreditsOverrideIndex::AddRoleOverride(const FCreditsRoleOverride& Override)
+{
+	RoleOverrides.Add(FCreditsOverrideKey(Override.ParentSection, Override.RoleToOverride, NAME_None), Override.OverrideData);
+}
+
+void FCreditsOverrideIndex::AddNameOverride(const FCreditsNameOverrides& Override)
+{
+	const FCreditsOverrideKey Key(Override.ParentSection, Override.ParentRole, Override.NameToOverride);
+	if (!NameOverrides.Contains(Key))
+	{
+		NameScopes.FindOrAdd(FCreditsOverrideKey(Override.ParentSection, Override.ParentRole, NAME_None)).Add(Override.NameToOverride);
+	}
+	NameOverrides.Add(Key, Override.OverrideData);
+}
+
+void FCreditsOverrideIndex::RemoveSectionOverride(const FName& Section)
+{
+	SectionOverrides.Remove(Section);
+}
+
+void FCreditsOverrideIndex::RemoveRoleOverride(const FCreditsOverrideKey& Key)
+{
+	RoleOverrides.Remove(Key);
+}
+
+void FCreditsOverrideIndex::RemoveNameOverride(const FCreditsOverrideKey& Key)
+{
+	if (NameOverrides.Remove(Key) == 0)
+	{
+		return;
+	}
+
+	const FCreditsOverrideKey ScopeKey(Key.Section, Key.Role, NAME_None);
+	TArray<FName>& Names = NameScopes.FindChecked(ScopeKey);
+	Names.RemoveSingleSwap(Key.Name);
+	if (Names.Num() == 0)
+	{
+		NameScopes.Remove(ScopeKey);
+	}
+}
+
+void FCreditsOverrideIndex::Reset()
+{
+	SectionOverrides.Reset();
+	RoleOverrides.Reset();
+	NameOverrides.Reset();
+	NameScopes.Reset();
+}
+
+const FCreditsSectionDefaults* FCreditsOverrideIndex::FindSectionOverride(const FName& Section) const
+{
+	return SectionOverrides.Find(Section);
+}
+
+const FCreditsRoleDefaults* FCreditsOverrideIndex::FindRoleOverride(const FName& Section, const FName& Role) const
+{
+	if (RoleOverrides.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	if (const FCreditsRoleDefaults* Found = RoleOverrides.Find(FCreditsOverrideKey(Section, Role, NAME_None)))
+	{
+		return Found;
+	}
+
+	return Section.IsNone() ? nullptr : RoleOverrides.Find(FCreditsOverrideKey(NAME_None, Role, NAME_None));
+}
+
+const FCreditsNameTextObject* FCreditsOverrideIndex::FindNameOverride(const FName& Section, const FName& Role, const FName& Name) const
+{
+	if (NameOverrides.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// most specific first: section and role, section only, then global.
+	if (const FCreditsNameTextObject* Found = NameOverrides.Find(FCreditsOverrideKey(Section, Role, Name)))
+	{
+		return Found;
+	}
+
+	if (!Role.IsNone())
+	{
+		if (const FCreditsNameTextObject* Found = NameOverrides.Find(FCreditsOverrideKey(Section, NAME_None, Name)))
+		{
+			return Found;
+		}
+	}
+
+	return Section.IsNone() ? nullptr : NameOverrides.Find(FCreditsOverrideKey(NAME_None, NAME_None, Name));
+}
+
+int32 FCreditsOverrideIndex::GetRoleOverrideRank(const FName& Section, const FName& Role, const FCreditsOverrideKey& Key)
+{
+	if (Key.Role != Role)
+	{
+		return 0;
+	}
+	if (Key.Section == Section)
+	{
+		return 2;
+	}
+	return Key.Section.IsNone() && !Section.IsNone() ? 1 : 0;
+}
+
+int32 FCreditsOverrideIndex::GetNameOverrideRank(const FName& Section, const FName& Role, const FName& Name, const FCreditsOverrideKey& Key)
+{
+	if (Key.Name != Name)
+	{
+		return 0;
+	}
+	if (Key.Section == Section && Key.Role == Role)
+	{
+		return 3;
+	}
+	if (Key.Section == Section && Key.Role.IsNone() && !Role.IsNone())
+	{
+		return 2;
+	}
+	return Key.Section.IsNone() && Key.Role.IsNone() && !Section.IsNone() ? 1 : 0;
+}
+
+void FCreditsOverrideIndex::GetNameOverridesInScope(const FName& Section, const FName& Role, TMap<FName, const FCreditsNameTextObject*>& OutNames) const
+{
+	if (NameOverrides.Num() == 0)
+	{
+		return;
+	}
+
+	const auto AddScope = [this, &OutNames](const FName& ScopeSection, const FName& ScopeRole)
+	{
+		if (const TArray<FName>* Names = NameScopes.Find(FCreditsOverrideKey(ScopeSection, ScopeRole, NAME_None)))
+		{
+			for (const FName& Name : *Names)
+			{
+				OutNames.Add(Name, &NameOverrides.FindChecked(FCreditsOverrideKey(ScopeSection, ScopeRole, Name)));
+			}
+		}
+	};
+
+	// the same fallbacks as FindNameOverride, least specific first so the more specific ones replace them.
+	if (!Section.IsNone())
+	{
+		AddScope(NAME_None, NAME_None);
+	}
+	if (!Role.IsNone())
+	{
+		AddScope(Section, NAME_None);
+	}
+	AddScope(Section, Role);
+}
+
+void FCreditsOverrideIndex::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<FName, FCreditsSectionDefaults>& Override : SectionOverrides)
+	{
+		Override.Value.AddReferencedObjects(Collector);
+	}
+
+	for (TPair<FCreditsOverrideKey, FCreditsRoleDefaults>& Override : RoleOverrides)
+	{
+		Override.Value.AddReferencedObjects(Collector);
+	}
+
+	for (TPair<FCreditsOverrideKey, FCreditsNameTextObject>& Override : NameOverrides)
+	{
+		Override.Value.AddReferencedObjects(Collector);
+	}
+}
+
+FString FCreditsOverrideIndex::GetReferencerName() const
+{
+	return TEXT("FCreditsOverrideIndex");
+}
+
+FCreditsOverrideIndexHandle::FCreditsOverrideIndexHandle(TSharedPtr<const FCreditsOverrideIndex> InIndex)
+{
+	Index = InIndex;
+}
+
+void FCreditsOverrideIndex::GetChangedKeys(const FCreditsOverrideIndex& Other, TArray<FCreditsOverrideKey>& OutSectionKeys, TArray<FCreditsOverrideKey>& OutRoleKeys, TArray<FCreditsOverrideKey>& OutNameKeys) const
+{
+	GetChangedCreditsOverrideKeys(SectionOverrides, Other.SectionOverrides, [](const FName& Section) { return FCreditsOverrideKey(Section, NAME_None, NAME_None); }, OutSectionKeys);
+	GetChangedCreditsOverrideKeys(RoleOverrides, Other.RoleOverrides, [](const FCreditsOverrideKey& Key) { return Key; }, OutRoleKeys);
+	GetChangedCreditsOverrideKeys(NameOverrides, Other.NameOverrides, [](const FCreditsOverrideKey& Key) { return Key; }, OutNameKeys);
+}
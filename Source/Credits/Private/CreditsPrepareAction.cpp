@@ -0,0 +1,62 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsPrepareAction.h"
+#include "CreditsCompiler.h"
+
+TSharedPtr<const FCreditsCompiledCredits> UCreditsPreparedCredits::GetCompiledCredits() const
+{
+	return Preparer.IsValid() ? Preparer->GetCompiledCredits() : nullptr;
+}
+
+TArray<FCreditsMusic> UCreditsPreparedCredits::GetMusic() const
+{
+	return Preparer.IsValid() ? Preparer->GetMusic() : TArray<FCreditsMusic>();
+}
+
+UCreditsPrepareAction* UCreditsPrepareAction::PrepareCredits(UObject* WorldContextObject, const FCreditsPrepareSources& Sources)
+{
+	UCreditsPrepareAction* Action = NewObject<UCreditsPrepareAction>();
+	Action->Sources = Sources;
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UCreditsPrepareAction::Cancel()
+{
+	if (Preparer.IsValid())
+	{
+		Preparer->Cancel();
+	}
+}
+
+void UCreditsPrepareAction::Activate()
+{
+	Preparer = MakeShared<FCreditsPreparer>(Sources);
+	Preparer->OnProgress.AddUObject(this, &UCreditsPrepareAction::HandleProgress);
+	Preparer->OnFinished.AddUObject(this, &UCreditsPrepareAction::HandleFinished);
+	Preparer->Start();
+}
+
+void UCreditsPrepareAction::HandleProgress(float Progress)
+{
+	OnProgress.Broadcast(Progress, nullptr);
+}
+
+void UCreditsPrepareAction::HandleFinished(ECreditsPrepareState FinalState)
+{
+	if (FinalState == ECreditsPrepareState::Done)
+	{
+		UCreditsPreparedCredits* PreparedCredits = NewObject<UCreditsPreparedCredits>();
+		PreparedCredits->Preparer = Preparer;
+		OnCompleted.Broadcast(1.0f, PreparedCredits);
+	}
+	else
+	{
+		OnCancelled.Broadcast(Preparer->GetProgress(), nullptr);
+	}
+
+	Preparer->OnProgress.RemoveAll(this);
+	Preparer->OnFinished.RemoveAll(this);
+	Preparer.Reset();
+	SetReadyToDestroy();
+}
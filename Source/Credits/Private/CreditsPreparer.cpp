@@ -0,0 +1,306 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsPreparer.h"
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "CreditsAssetStreamer.h"
+#include "CreditsCompiler.h"
+#include "CreditsConverter.h"
+#include "CreditsDefaultAssets.h"
+#include "CreditsGlyphPrewarm.h"
+#include "CreditsLayout.h"
+#include "CreditsModule.h"
+#include "CreditsOverrideIndex.h"
+#include "CreditsStats.h"
+
+/** Share of the progress each stage ends at. */
+static const float CreditsPrepareLoadedProgress = 0.3f;
+static const float CreditsPrepareCompiledProgress = 0.7f;
+static const float CreditsPrepareFinalizedProgress = 0.8f;
+
+FCreditsPreparer::FCreditsPreparer(const FCreditsPrepareSources& InSources)
+	: Sources(InSources)
+	, State(ECreditsPrepareState::Idle)
+	, NumCompiledSections(0)
+	, NumSections(0)
+	, bCancelled(false)
+{
+}
+
+FCreditsPreparer::~FCreditsPreparer()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FCreditsPreparer::Start()
+{
+	check(IsInGameThread());
+	if (State != ECreditsPrepareState::Idle)
+	{
+		return;
+	}
+
+	// the struct defaults only resolve on the game thread, workers then only read them.
+	FCreditsDefaultAssets::Get();
+
+	Overrides = MakeShared<FCreditsOverrideIndex>();
+
+	TArray<FSoftObjectPath> Tables;
+	for (const TSoftObjectPtr<UDataTable>* Table : { &Sources.Sections, &Sources.SectionOverrides, &Sources.RoleOverrides, &Sources.NameOverrides, &Sources.Music })
+	{
+		if (!Table->IsNull())
+		{
+			Tables.Add(Table->ToSoftObjectPath());
+		}
+	}
+
+	State = ECreditsPrepareState::Loading;
+	if (Tables.Num() > 0)
+	{
+		TablesHandle = FCreditsAssetStreamer::GetStreamableManager().RequestAsyncLoad(Tables);
+	}
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FCreditsPreparer::Tick));
+}
+
+void FCreditsPreparer::Cancel()
+{
+	bCancelled = true;
+}
+
+float FCreditsPreparer::GetProgress() const
+{
+	switch (State)
+	{
+	case ECreditsPrepareState::Loading:
+		return TablesHandle.IsValid() ? TablesHandle->GetProgress() * CreditsPrepareLoadedProgress : CreditsPrepareLoadedProgress;
+	case ECreditsPrepareState::Compiling:
+	{
+		const int32 Total = NumSections;
+		const float Fraction = Total > 0 ? (float)NumCompiledSections / Total : 0.0f;
+		return FMath::Lerp(CreditsPrepareLoadedProgress, CreditsPrepareCompiledProgress, Fraction);
+	}
+	case ECreditsPrepareState::Finalizing:
+		return CreditsPrepareCompiledProgress;
+	case ECreditsPrepareState::Streaming:
+		return FMath::Lerp(CreditsPrepareFinalizedProgress, 1.0f, AssetsHandle.IsValid() ? AssetsHandle->GetProgress() : 1.0f);
+	case ECreditsPrepareState::Done:
+		return 1.0f;
+	default:
+		return 0.0f;
+	}
+}
+
+TSharedPtr<const FCreditsCompiledCredits> FCreditsPreparer::GetCompiledCredits() const
+{
+	return State == ECreditsPrepareState::Done ? Compiled : nullptr;
+}
+
+bool FCreditsPreparer::Tick(float DeltaTime)
+{
+	// the finished delegates may drop the last reference to the preparer.
+	const TSharedRef<FCreditsPreparer> KeepAlive = AsShared();
+
+	// the worker stage is left to notice the cancellation itself, it still owns the compiled credits.
+	if (bCancelled && State != ECreditsPrepareState::Compiling)
+	{
+		Finish(ECreditsPrepareState::Cancelled);
+		return false;
+	}
+
+	switch (State)
+	{
+	case ECreditsPrepareState::Loading:
+		if (!TablesHandle.IsValid() || TablesHandle->HasLoadCompleted())
+		{
+			if (const UDataTable* MusicTable = Sources.Music.Get())
+			{
+				TArray<FCreditsMusic*> MusicRows;
+				MusicTable->GetAllRows<FCreditsMusic>(TEXT("FCreditsPreparer"), MusicRows);
+				for (const FCreditsMusic* Row : MusicRows)
+				{
+					Music.Add(*Row);
+				}
+			}
+
+			// every object is looked at here, the worker only reads the rows, kept loaded by the tables handle, and
+			// writes credits the collector does not see until they are handed back.
+			const UDataTable* SectionsTable = Sources.Sections.Get();
+			const UScriptStruct* RowStruct = SectionsTable ? SectionsTable->GetRowStruct() : nullptr;
+			const bool bSimpleSections = !(RowStruct && RowStruct->IsChildOf(FCreditsSection::StaticStruct()));
+			if (SectionsTable && bSimpleSections && !(RowStruct && RowStruct->IsChildOf(FCreditsSectionSimple::StaticStruct())))
+			{
+				UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsPreparer: %s holds neither FCreditsSection nor FCreditsSectionSimple rows"), *SectionsTable->GetName());
+				SectionsTable = nullptr;
+			}
+
+			// the sections are counted before the worker starts, so the progress moves from its first section.
+			NumSections = SectionsTable ? SectionsTable->GetRowMap().Num() : 0;
+			if (bSimpleSections)
+			{
+				Overrides->Build(Sources.SectionOverrides.Get(), Sources.RoleOverrides.Get(), Sources.NameOverrides.Get());
+			}
+			Compiled = MakeShared<FCreditsCompiledCredits>(FGCObject::EFlags::RegisterLater);
+			for (const TSoftObjectPtr<UDataTable>* Table : { &Sources.Sections, &Sources.SectionOverrides, &Sources.RoleOverrides, &Sources.NameOverrides })
+			{
+				FCreditsCompiler::AddTableImages(Table->Get(), *Compiled);
+			}
+
+			State = ECreditsPrepareState::Compiling;
+			CompileTask = Async(EAsyncExecution::ThreadPool, [This = AsShared(), SectionsTable, bSimpleSections]()
+			{
+				This->Compile(SectionsTable, bSimpleSections);
+			});
+		}
+		break;
+
+	case ECreditsPrepareState::Compiling:
+		if (CompileTask.IsReady())
+		{
+			if (bCancelled)
+			{
+				Finish(ECreditsPrepareState::Cancelled);
+				return false;
+			}
+			// the credits are back on the game thread, from here on the collector keeps their objects alive.
+			Compiled->RegisterGCObject();
+			State = ECreditsPrepareState::Finalizing;
+			Finalize();
+			State = ECreditsPrepareState::Streaming;
+		}
+		break;
+
+	case ECreditsPrepareState::Streaming:
+		if (!AssetsHandle.IsValid() || AssetsHandle->HasLoadCompleted())
+		{
+			Finish(ECreditsPrepareState::Done);
+			return false;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	OnProgress.Broadcast(GetProgress());
+	return true;
+}
+
+void FCreditsPreparer::Compile(const UDataTable* SectionsTable, bool bSimpleSections)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsCompile);
+	LLM_SCOPE_BYTAG(Credits);
+
+	if (SectionsTable == nullptr)
+	{
+		return;
+	}
+
+	// a section at a time, each converted with its names spread across workers, so the progress follows the sections.
+	const FCreditsOverrideIndex* SectionOverrides = Overrides->IsEmpty() ? nullptr : Overrides.Get();
+	FCreditsSection Converted;
+	for (const TPair<FName, uint8*>& Row : SectionsTable->GetRowMap())
+	{
+		if (bCancelled)
+		{
+			return;
+		}
+		if (bSimpleSections)
+		{
+			FCreditsConverter::ConvertSection(*reinterpret_cast<const FCreditsSectionSimple*>(Row.Value), SectionOverrides, Row.Key, Converted);
+			FCreditsCompiler::CompileSection(Converted, *Compiled);
+		}
+		else
+		{
+			FCreditsCompiler::CompileSection(*reinterpret_cast<const FCreditsSection*>(Row.Value), *Compiled);
+		}
+		++NumCompiledSections;
+	}
+	Compiled->Lines.UpdateOffsets();
+}
+
+void FCreditsPreparer::Finalize()
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsPrepare);
+	LLM_SCOPE_BYTAG(Credits);
+
+	// the worker added every soft image unloaded, those loaded already are taken now.
+	for (int32 ImageIndex = 0; ImageIndex < Compiled->Images.Num(); ++ImageIndex)
+	{
+		if (Compiled->SoftImages[ImageIndex] && Compiled->Images[ImageIndex] == nullptr)
+		{
+			if (UTexture2D* Texture = Cast<UTexture2D>(Compiled->ImagePaths[ImageIndex].ResolveObject()))
+			{
+				Compiled->SetImage(ImageIndex, Texture);
+			}
+		}
+	}
+
+	FCreditsLayout::Layout(*Compiled);
+	FCreditsGlyphPrewarm::Prewarm(*Compiled);
+
+	// fonts and music are hard references of the rows, loaded with the tables, only the opening soft images are left.
+	const FCreditsLineTable& Lines = Compiled->Lines;
+	TArray<int32> ImageIndices;
+	TArray<FSoftObjectPath> ImagePaths;
+	for (int32 Line = 0; Line < Lines.Num(); ++Line)
+	{
+		if (Sources.PreloadDistance >= 0.0f && Lines.OffsetsY[Line] > Sources.PreloadDistance)
+		{
+			break;
+		}
+
+		const int32 ImageIndex = Lines.ImageIndices[Line];
+		if (ImageIndex != INDEX_NONE && Compiled->SoftImages[ImageIndex] && Compiled->Images[ImageIndex] == nullptr && !ImageIndices.Contains(ImageIndex))
+		{
+			ImageIndices.Add(ImageIndex);
+			ImagePaths.Add(Compiled->ImagePaths[ImageIndex]);
+		}
+	}
+
+	if (ImagePaths.Num() == 0)
+	{
+		return;
+	}
+
+	TWeakPtr<FCreditsCompiledCredits> WeakCredits = Compiled;
+	AssetsHandle = FCreditsAssetStreamer::GetStreamableManager().RequestAsyncLoad(ImagePaths, FStreamableDelegate::CreateLambda([WeakCredits, ImageIndices, ImagePaths]()
+	{
+		TSharedPtr<FCreditsCompiledCredits> PinnedCredits = WeakCredits.Pin();
+		if (!PinnedCredits.IsValid())
+		{
+			return;
+		}
+		for (int32 Index = 0; Index < ImageIndices.Num(); ++Index)
+		{
+			PinnedCredits->SetImage(ImageIndices[Index], Cast<UTexture2D>(ImagePaths[Index].ResolveObject()));
+		}
+	}));
+}
+
+void FCreditsPreparer::Finish(ECreditsPrepareState FinalState)
+{
+	State = FinalState;
+	TickerHandle.Reset();
+
+	// once done, the tables stay loaded as they hold the music the rows point at.
+	if (FinalState == ECreditsPrepareState::Cancelled)
+	{
+		if (TablesHandle.IsValid())
+		{
+			TablesHandle->CancelHandle();
+			TablesHandle.Reset();
+		}
+		if (AssetsHandle.IsValid())
+		{
+			AssetsHandle->CancelHandle();
+			AssetsHandle.Reset();
+		}
+		Compiled.Reset();
+	}
+
+	UE_LOG(ClosingCreditsLog, Log, TEXT("FCreditsPreparer: %s"), FinalState == ECreditsPrepareState::Done ? TEXT("done") : TEXT("cancelled"));
+	OnFinished.Broadcast(FinalState);
+}
@@ -1,27 +1,217 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
 
 #include "CreditsSpawner.h"
+#include "CreditsStats.h"
+#include "CreditsVirtualRoller.h"
 
-// Sets default values
 ACreditsSpawner::ACreditsSpawner()
+	: DefaultSpeed(60.0f)
+	, RollTickInterval(0.0f)
+	, bInterpolateScrolling(true)
+	, bSyncToMusic(false)
+	, Roller(nullptr)
+	, MusicSyncOffset(0.0)
+	, StartOffset(0.0f)
+	, ScrollOffset(0.0f)
+	, RollTime(0.0f)
+	, bRolling(false)
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	// the tick is only enabled for the length of a roll and of its music, idle spawners are never ticked.
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+}
+
+void ACreditsSpawner::StartRoll(UCreditsVirtualRoller* InRoller)
+{
+	if (InRoller == nullptr)
+	{
+		return;
+	}
+
+	Roller = InRoller;
+	RollTime = 0.0f;
+	bRolling = true;
+	Curves.Bake(GeneralSettings, DefaultSpeed);
+
+	// starting from the bottom, the credits scroll in from below the roller.
+	const float ViewportHeight = Roller->GetCachedGeometry().GetLocalSize().Y;
+	StartOffset = GeneralSettings.CreditsStartingPosition == ECreditsStartingPosition::Bottom ? -ViewportHeight : 0.0f;
+	ScrollOffset = StartOffset;
+	Roller->SetScrollOffset(ScrollOffset);
+	FollowRollerOffset();
+	Roller->SetScrollSpeed(0.0f);
+
+	if (GeneralSettings.AutoPlayMusic)
+	{
+		MusicQueue.Start(GetWorld(), Music, GeneralSettings.RestartMusicAtEnd);
+		MusicQueue.SetVolume(Curves.Volume.Evaluate(0.0f));
+	}
+	MusicSyncOffset = -MusicQueue.GetPlaybackTime();
+
+	SetActorTickInterval(RollTickInterval);
+	SetActorTickEnabled(true);
+}
+
+void ACreditsSpawner::StopRoll()
+{
+	if (Roller)
+	{
+		Roller->SetScrollSpeed(0.0f);
+	}
+	bRolling = false;
+
+	if (GeneralSettings.StopMusicOnCreditsEnded)
+	{
+		MusicQueue.Stop();
+	}
+	else if (GeneralSettings.StopQueueingMusicWhenCreditsEnded)
+	{
+		MusicQueue.StopQueueing();
+	}
+
+	// the music may still have tracks to queue after the roll.
+	SetActorTickEnabled(MusicQueue.IsQueueing());
+}
+
+void ACreditsSpawner::PlayMusicTrack(int32 Index)
+{
+	// without a roll playing the music the queue is started with every track waiting for Play Track.
+	if (!MusicQueue.GetTracks().IsValidIndex(Index))
+	{
+		MusicQueue.Start(GetWorld(), Music, GeneralSettings.RestartMusicAtEnd, false);
+	}
+	MusicQueue.PlayTrack(Index);
+	SetActorTickEnabled(true);
+}
+
+void ACreditsSpawner::StopMusic()
+{
+	MusicQueue.Stop();
+	SetActorTickEnabled(bRolling);
+}
+
+void ACreditsSpawner::SeekToTime(float Time)
+{
+	if (Roller == nullptr)
+	{
+		return;
+	}
+
+	RollTime = FMath::Max(0.0f, Time);
+	MusicSyncOffset = RollTime - MusicQueue.GetPlaybackTime();
+	ScrollOffset = StartOffset + Curves.Speed.EvaluateIntegral(RollTime);
+	Roller->SeekToOffset(ScrollOffset);
+	FollowRollerOffset();
+}
 
+void ACreditsSpawner::SeekToOffset(float Offset)
+{
+	SeekToTime(Curves.Speed.FindTimeAtIntegral(Offset - StartOffset));
 }
 
-// Called when the game starts or when spawned
-void ACreditsSpawner::BeginPlay()
+bool ACreditsSpawner::SeekToSection(FName Section)
 {
-	Super::BeginPlay();
-	
+	float Offset;
+	if (Roller == nullptr || !Roller->FindSectionOffset(Section, Offset))
+	{
+		return false;
+	}
+
+	SeekToOffset(Offset);
+
+	// the sections compiled by the seek may have moved the section from its estimated offset.
+	if (Roller->FindSectionOffset(Section, Offset) && Offset != ScrollOffset)
+	{
+		SeekToOffset(Offset);
+	}
+	return true;
+}
+
+void ACreditsSpawner::FollowRollerOffset()
+{
+	// the roll position stays the integral of the speed, from a start moved by as much as the offset.
+	const float RollerOffset = Roller->GetScrollOffset();
+	StartOffset += RollerOffset - ScrollOffset;
+	ScrollOffset = RollerOffset;
 }
 
-// Called every frame
 void ACreditsSpawner::Tick(float DeltaTime)
 {
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsScroll);
+
 	Super::Tick(DeltaTime);
 
+	// DeltaTime is dilated, the undilated time is recovered when dilation should not slow the credits down.
+	const float TimeDilation = FMath::Max(GetActorTimeDilation(), KINDA_SMALL_NUMBER);
+	const float RealDeltaTime = DeltaTime / TimeDilation;
+
+	// the music plays on real time.
+	MusicQueue.Update(RealDeltaTime);
+
+	if (bRolling)
+	{
+		if (IsValid(Roller))
+		{
+			const FCreditsPlaybackClock* MusicClock = bSyncToMusic && MusicQueue.IsPlaying() ? &MusicQueue.GetPlaybackClock() : nullptr;
+			TickRoll(GeneralSettings.TimeDilationEffectsCredits ? DeltaTime : RealDeltaTime, TimeDilation, MusicClock);
+		}
+		else
+		{
+			StopRoll();
+		}
+	}
+
+	if (!bRolling && !MusicQueue.IsQueueing())
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+void ACreditsSpawner::TickRoll(float RollDeltaTime, float TimeDilation, const FCreditsPlaybackClock* MusicClock)
+{
+	// the position is the integral of the speed up to the roll time, not a sum of frames.
+	const float PreviousOffset = ScrollOffset;
+	const bool bSynced = MusicClock != nullptr;
+	const double MusicTime = bSynced ? MusicClock->GetTime() : MusicQueue.GetPlaybackTime();
+	if (bSynced)
+	{
+		RollTime = (float)(MusicTime + MusicSyncOffset);
+	}
+	else
+	{
+		RollTime += RollDeltaTime;
+	}
+	MusicSyncOffset = RollTime - MusicTime;
+	ScrollOffset = StartOffset + Curves.Speed.EvaluateIntegral(RollTime);
+	Roller->SetScrollOffset(ScrollOffset);
+	FollowRollerOffset();
+	MusicQueue.SetVolume(Curves.Volume.Evaluate(RollTime));
+
+	// the roller advances on real time between two ticks.
+	if (bInterpolateScrolling)
+	{
+		const float Speed = Curves.Speed.Evaluate(RollTime);
+		Roller->SetScrollSpeed(GeneralSettings.TimeDilationEffectsCredits && !bSynced ? Speed * TimeDilation : Speed);
+	}
+
+	const float TotalHeight = Roller->GetTotalHeight();
+	if (PreviousOffset < TotalHeight && ScrollOffset >= TotalHeight)
+	{
+		if (GeneralSettings.EndCreditsOnEndReached)
+		{
+			StopRoll();
+		}
+		OnRollEnded.Broadcast();
+	}
 }
 
+void ACreditsSpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRolling)
+	{
+		StopRoll();
+	}
+	MusicQueue.Stop();
+
+	Super::EndPlay(EndPlayReason);
+}
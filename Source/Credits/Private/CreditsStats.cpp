@@ -0,0 +1,23 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsStats.h"
+
+DEFINE_STAT(STAT_CreditsImport);
+DEFINE_STAT(STAT_CreditsConvert);
+DEFINE_STAT(STAT_CreditsCompile);
+DEFINE_STAT(STAT_CreditsRecompile);
+DEFINE_STAT(STAT_CreditsLayout);
+DEFINE_STAT(STAT_CreditsPrepare);
+DEFINE_STAT(STAT_CreditsUpdateWidgets);
+DEFINE_STAT(STAT_CreditsPaint);
+DEFINE_STAT(STAT_CreditsScroll);
+DEFINE_STAT(STAT_CreditsStreamImages);
+DEFINE_STAT(STAT_CreditsScheduleMusic);
+
+DEFINE_STAT(STAT_CreditsLiveWidgets);
+DEFINE_STAT(STAT_CreditsVisibleLines);
+DEFINE_STAT(STAT_CreditsLoadedTextures);
+
+LLM_DEFINE_TAG(Credits);
+
+UE_TRACE_CHANNEL_DEFINE(CreditsChannel);
@@ -0,0 +1,36 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsStyleResolver.h"
+
+FCreditsStyleResolver::FCreditsStyleResolver(const FCreditsOverrideIndex* InOverrides)
+	: Overrides(InOverrides && !InOverrides->IsEmpty() ? InOverrides : nullptr)
+{
+}
+
+const FCreditsSectionDefaults& FCreditsStyleResolver::ResolveSection(const FName& Section) const
+{
+	const FCreditsSectionDefaults* Override = Overrides ? Overrides->FindSectionOverride(Section) : nullptr;
+	return Override ? *Override : SectionTemplate;
+}
+
+int32 FCreditsStyleResolver::ResolveScope(const FName& Section, const FName& Role)
+{
+	const FCreditsOverrideKey Key(Section, Role, NAME_None);
+	if (const int32* Found = ScopeLookup.Find(Key))
+	{
+		return *Found;
+	}
+
+	const int32 ScopeIndex = Scopes.AddDefaulted();
+	FCreditsStyleScope& Scope = Scopes[ScopeIndex];
+	const FCreditsRoleDefaults* RoleOverride = Overrides ? Overrides->FindRoleOverride(Section, Role) : nullptr;
+	Scope.Role = RoleOverride ? RoleOverride : &RoleTemplate;
+	Scope.Name = &NameTemplate;
+	if (Overrides)
+	{
+		Overrides->GetNameOverridesInScope(Section, Role, Scope.NameDeltas);
+	}
+
+	ScopeLookup.Add(Key, ScopeIndex);
+	return ScopeIndex;
+}
@@ -0,0 +1,121 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsStyleTable.h"
+#include "UObject/GCObject.h"
+#include "CreditsModule.h"
+
+FCreditsLineStyle::FCreditsLineStyle(const FCreditsTextProperties& InTextProperties, const FCreditsImageProperties& InImageProperties, const FCreditsPaddingMargin& InPadding)
+{
+	Font = InTextProperties.Font;
+	FontMaterial = InTextProperties.FontMaterial;
+	FontSize = InTextProperties.FontSize;
+	Color = InTextProperties.Color;
+	Padding = InPadding;
+	ImageSizeOverride = InImageProperties.ImageSizeOverride;
+	ImageSizeProperties = InImageProperties.ImageSizeProperties;
+}
+
+bool FCreditsLineStyle::operator==(const FCreditsLineStyle& Other) const
+{
+	return Font == Other.Font
+		&& FontMaterial == Other.FontMaterial
+		&& FontSize == Other.FontSize
+		&& Color == Other.Color
+		&& Padding.Left == Other.Padding.Left
+		&& Padding.Top == Other.Padding.Top
+		&& Padding.Right == Other.Padding.Right
+		&& Padding.Bottom == Other.Padding.Bottom
+		&& ImageSizeOverride == Other.ImageSizeOverride
+		&& ImageSizeProperties == Other.ImageSizeProperties;
+}
+
+uint32 GetTypeHash(const FCreditsLineStyle& Style)
+{
+	uint32 Hash = HashCombine(GetTypeHash(Style.Font), GetTypeHash(Style.FontMaterial));
+	Hash = HashCombine(Hash, GetTypeHash(Style.FontSize));
+	Hash = HashCombine(Hash, GetTypeHash(Style.Color));
+	Hash = HashCombine(Hash, GetTypeHash(Style.Padding.Left));
+	Hash = HashCombine(Hash, GetTypeHash(Style.Padding.Top));
+	Hash = HashCombine(Hash, GetTypeHash(Style.Padding.Right));
+	Hash = HashCombine(Hash, GetTypeHash(Style.Padding.Bottom));
+	Hash = HashCombine(Hash, GetTypeHash(Style.ImageSizeOverride));
+	return HashCombine(Hash, GetTypeHash(Style.ImageSizeProperties));
+}
+
+uint16 FCreditsStyleTable::Intern(const FCreditsLineStyle& Style)
+{
+	// the names of a role mostly share their style, so the last one interned is compared before anything is hashed.
+	if (Styles.IsValidIndex(LastIndex) && Styles[LastIndex] == Style)
+	{
+		return (uint16)LastIndex;
+	}
+
+	const uint32 Hash = GetTypeHash(Style);
+	if (const uint16* Found = Lookup.FindByHash(Hash, Style))
+	{
+		LastIndex = *Found;
+		return *Found;
+	}
+
+	if (Styles.Num() > MAX_uint16)
+	{
+		UE_LOG(ClosingCreditsLog, Warning, TEXT("FCreditsStyleTable: more than %d unique styles, falling back to the first style."), MAX_uint16 + 1);
+		return 0;
+	}
+
+	const uint16 StyleIndex = (uint16)Styles.Add(Style);
+
+	FSlateFontInfo& FontInfo = FontInfos.Emplace_GetRef(Style.Font, Style.FontSize);
+	FontInfo.FontMaterial = Style.FontMaterial;
+
+	Lookup.AddByHash(Hash, Style, StyleIndex);
+	LastIndex = StyleIndex;
+	return StyleIndex;
+}
+
+void FCreditsStyleTable::Reset()
+{
+	Styles.Reset();
+	FontInfos.Reset();
+	Lookup.Reset();
+	LastIndex = INDEX_NONE;
+}
+
+void FCreditsStyleTable::Compact(const TBitArray<>& bUsed, TArray<uint16>& OutRemap)
+{
+	OutRemap.SetNumZeroed(Styles.Num());
+	Lookup.Reset();
+	int32 NumKept = 0;
+	for (int32 StyleIndex = 0; StyleIndex < Styles.Num(); ++StyleIndex)
+	{
+		if (!bUsed[StyleIndex])
+		{
+			continue;
+		}
+		if (NumKept != StyleIndex)
+		{
+			Styles[NumKept] = MoveTemp(Styles[StyleIndex]);
+			FontInfos[NumKept] = MoveTemp(FontInfos[StyleIndex]);
+		}
+		OutRemap[StyleIndex] = (uint16)NumKept;
+		Lookup.Add(Styles[NumKept], (uint16)NumKept);
+		++NumKept;
+	}
+	Styles.SetNum(NumKept);
+	FontInfos.SetNum(NumKept);
+	LastIndex = INDEX_NONE;
+}
+
+SIZE_T FCreditsStyleTable::GetAllocatedSize() const
+{
+	return Styles.GetAllocatedSize() + FontInfos.GetAllocatedSize() + Lookup.GetAllocatedSize();
+}
+
+void FCreditsStyleTable::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FCreditsLineStyle& Style : Styles)
+	{
+		Collector.AddReferencedObject(Style.Font);
+		Collector.AddReferencedObject(Style.FontMaterial);
+	}
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsSynthetic.h"
+#include "Engine/Texture2D.h"
+
+/** Font sizes the overrides pick from, so overridden lines spread over a few styles like hand made ones. */
+static const int32 CreditsSyntheticFontSizes[] = { 18, 20, 28, 32 };
+
+void FCreditsSyntheticCredits::Generate(const FCreditsSyntheticSettings& Settings)
+{
+	Sections.Reset();
+	RoleOverrides.Reset();
+	NameOverrides.Reset();
+
+	FRandomStream Random(Settings.Seed);
+	const int32 NamesPerRole = FMath::Max(1, Settings.NamesPerRole);
+	const int32 RolesPerSection = FMath::Max(1, Settings.RolesPerSection);
+
+	Images.Reset(Settings.NumImages);
+	for (int32 Index = 0; Index < Settings.NumImages; ++Index)
+	{
+		Images.Add(UTexture2D::CreateTransient(64 << (Index % 3), 64));
+	}
+
+	const int32 NumRoles = FMath::DivideAndRoundUp(Settings.NumNames, NamesPerRole);
+	Sections.Reserve(FMath::DivideAndRoundUp(NumRoles, RolesPerSection));
+	RoleOverrides.Reserve(FMath::CeilToInt(NumRoles * Settings.OverrideDensity));
+	NameOverrides.Reserve(FMath::CeilToInt(Settings.NumNames * Settings.OverrideDensity));
+
+	int32 NameIndex = 0;
+	while (NameIndex < Settings.NumNames)
+	{
+		FCreditsSectionSimple& Section = Sections.AddDefaulted_GetRef();
+		Section.Title.Text = FString::Printf(TEXT("Section %d"), Sections.Num());
+		const FName SectionKey(*Section.Title.Text);
+
+		Section.Roles.Reserve(RolesPerSection);
+		for (int32 RoleIndex = 0; RoleIndex < RolesPerSection && NameIndex < Settings.NumNames; ++RoleIndex)
+		{
+			FCreditsRoleStructSimple& Role = Section.Roles.AddDefaulted_GetRef();
+			Role.Role.Text = FString::Printf(TEXT("Role %d"), RoleIndex);
+			Role.DisplayRoleName = true;
+			const FName RoleKey(*Role.Role.Text);
+
+			if (Random.FRand() < Settings.OverrideDensity)
+			{
+				FCreditsRoleOverride& Override = RoleOverrides.AddDefaulted_GetRef();
+				Override.ParentSection = SectionKey;
+				Override.RoleToOverride = RoleKey;
+				Override.OverrideData.RolePosition = Random.RandHelper(2) ? ECreditsTextPosition::Side : ECreditsTextPosition::Top;
+				Override.OverrideData.Role.TextProperties.FontSize = CreditsSyntheticFontSizes[Random.RandHelper(UE_ARRAY_COUNT(CreditsSyntheticFontSizes))];
+			}
+
+			Role.PlayedBy.SetNum(FMath::Min(NamesPerRole, Settings.NumNames - NameIndex));
+			for (FCreditsTextObjectSimple& Name : Role.PlayedBy)
+			{
+				Name.Text = FString::Printf(TEXT("Firstname Lastname %d"), NameIndex++);
+				if (Images.Num() > 0 && Random.FRand() < Settings.ImageRatio)
+				{
+					Name.ImageProperties.Image = Images[Random.RandHelper(Images.Num())];
+				}
+
+				if (Random.FRand() < Settings.OverrideDensity)
+				{
+					FCreditsNameOverrides& Override = NameOverrides.AddDefaulted_GetRef();
+					Override.ParentSection = SectionKey;
+					Override.ParentRole = RoleKey;
+					Override.NameToOverride = FName(*Name.Text);
+					Override.OverrideData.TextProperties.FontSize = CreditsSyntheticFontSizes[Random.RandHelper(UE_ARRAY_COUNT(CreditsSyntheticFontSizes))];
+				}
+			}
+		}
+	}
+}
+
+int32 FCreditsSyntheticCredits::GetNumNames() const
+{
+	int32 NumNames = 0;
+	for (const FCreditsSectionSimple& Section : Sections)
+	{
+		for (const FCreditsRoleStructSimple& Role : Section.Roles)
+		{
+			NumNames += Role.PlayedBy.Num();
+		}
+	}
+	return NumNames;
+}
+
+void FCreditsSyntheticCredits::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(Images);
+}
+
+FString FCreditsSyntheticCredits::GetReferencerName() const
+{
+	return TEXT("FCreditsSyntheticCredits");
+}
@@ -0,0 +1,359 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "CreditsVirtualRoller.h"
+#include "Misc/App.h"
+#include "CreditsAssetStreamer.h"
+#include "CreditsCompiler.h"
+#include "CreditsGlyphPrewarm.h"
+#include "CreditsImageAtlas.h"
+#include "CreditsIncrementalCompiler.h"
+#include "CreditsLayout.h"
+#include "CreditsLazyCompiler.h"
+#include "CreditsPrepareAction.h"
+#include "SCreditsLinePainter.h"
+#include "SCreditsVirtualRoller.h"
+
+#define LOCTEXT_NAMESPACE "Credits"
+
+UCreditsVirtualRoller::UCreditsVirtualRoller(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, ViewportMargin(200.0f)
+	, StreamingLookahead(5.0f)
+	, LazyLookahead(1000.0f)
+	, bPrewarmGlyphs(true)
+	, bBuildImageAtlas(false)
+	, ImageAtlas(nullptr)
+	, RenderMode(ECreditsRenderMode::Widgets)
+	, ScrollOffset(0.0f)
+	, ScrollSpeed(0.0f)
+{
+}
+
+void UCreditsVirtualRoller::SetCredits(const TArray<FCreditsSection>& Sections)
+{
+	TSharedRef<FCreditsCompiledCredits> Compiled = MakeShared<FCreditsCompiledCredits>();
+	FCreditsCompiler::Compile(Sections, *Compiled);
+	FCreditsLayout::Layout(*Compiled);
+
+	if (bPrewarmGlyphs)
+	{
+		// before the first paint the geometry is not cached yet, glyphs are then cached at scale 1.
+		const float FontScale = GetCachedGeometry().Scale;
+		FCreditsGlyphPrewarm::Prewarm(*Compiled, FontScale > 0.0f ? FontScale : 1.0f);
+	}
+
+	SetOwnedCompiledCredits(Compiled);
+}
+
+void UCreditsVirtualRoller::SetPreparedCredits(UCreditsPreparedCredits* PreparedCredits)
+{
+	// the prepared credits may be rolled by several rollers, each packs and streams the images of its own copy.
+	TSharedPtr<const FCreditsCompiledCredits> Prepared = PreparedCredits ? PreparedCredits->GetCompiledCredits() : nullptr;
+	if (Prepared.IsValid())
+	{
+		SetOwnedCompiledCredits(MakeShared<FCreditsCompiledCredits>(*Prepared));
+	}
+}
+
+void UCreditsVirtualRoller::SetLiveCredits(UDataTable* Sections, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides)
+{
+	TSharedRef<FCreditsIncrementalCompiler> Compiler = MakeShared<FCreditsIncrementalCompiler>(Sections, SectionOverrides, RoleOverrides, NameOverrides);
+	Compiler->Start();
+
+	const TSharedRef<FCreditsCompiledCredits> Compiled = Compiler->GetCompiledCredits();
+	if (bPrewarmGlyphs)
+	{
+		const float FontScale = GetCachedGeometry().Scale;
+		FCreditsGlyphPrewarm::Prewarm(*Compiled, FontScale > 0.0f ? FontScale : 1.0f);
+	}
+
+	LiveCompiler = Compiler;
+	Compiler->OnRecompiled.AddUObject(this, &UCreditsVirtualRoller::HandleCreditsRecompiled);
+	SetOwnedCompiledCredits(Compiled);
+}
+
+void UCreditsVirtualRoller::SetLazyCredits(UDataTable* Sections, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides)
+{
+	TSharedRef<FCreditsLazyCompiler> Compiler = MakeShared<FCreditsLazyCompiler>(Sections, SectionOverrides, RoleOverrides, NameOverrides);
+	Compiler->Start();
+
+	LazyCompiler = Compiler;
+	SetOwnedCompiledCredits(Compiler->GetCompiledCredits());
+	UpdateLazyCompiler();
+}
+
+void UCreditsVirtualRoller::SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCompiledCredits)
+{
+	// any other credits stop following the live tables.
+	if (LiveCompiler.IsValid() && InCompiledCredits.Get() != &LiveCompiler->GetCompiledCredits().Get())
+	{
+		LiveCompiler.Reset();
+	}
+	if (LazyCompiler.IsValid() && InCompiledCredits.Get() != &LazyCompiler->GetCompiledCredits().Get())
+	{
+		LazyCompiler.Reset();
+	}
+
+	CompiledCredits = InCompiledCredits;
+	AssetStreamer.Reset();
+	if (MyRoller.IsValid())
+	{
+		MyRoller->SetCompiledCredits(CompiledCredits);
+	}
+	if (MyPainter.IsValid())
+	{
+		MyPainter->SetCompiledCredits(CompiledCredits);
+	}
+}
+
+void UCreditsVirtualRoller::SetScrollOffset(float InScrollOffset)
+{
+	ScrollOffset = InScrollOffset;
+	UpdateLazyCompiler();
+	UpdateAssetStreamer();
+
+	if (MyRoller.IsValid())
+	{
+		MyRoller->SetScrollOffset(ScrollOffset);
+	}
+	if (MyPainter.IsValid())
+	{
+		MyPainter->SetScrollOffset(ScrollOffset);
+	}
+}
+
+void UCreditsVirtualRoller::SeekToOffset(float Offset)
+{
+	if (AssetStreamer.IsValid())
+	{
+		AssetStreamer->NotifySeek();
+	}
+	SetScrollOffset(Offset);
+}
+
+bool UCreditsVirtualRoller::SeekToSection(FName Section)
+{
+	float Offset;
+	if (!FindSectionOffset(Section, Offset))
+	{
+		return false;
+	}
+
+	SeekToOffset(Offset);
+
+	// the sections compiled by the seek may have moved the section from its estimated offset.
+	if (LazyCompiler.IsValid() && FindSectionOffset(Section, Offset) && Offset != ScrollOffset)
+	{
+		SetScrollOffset(Offset);
+	}
+	return true;
+}
+
+bool UCreditsVirtualRoller::FindSectionOffset(FName Section, float& OutOffset) const
+{
+	const int32 SectionIndex = CompiledCredits.IsValid() ? CompiledCredits->Lines.FindSection(Section) : INDEX_NONE;
+	if (SectionIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutOffset = CompiledCredits->Lines.SectionOffsetsY[SectionIndex];
+	return true;
+}
+
+FName UCreditsVirtualRoller::GetCurrentSection() const
+{
+	if (!CompiledCredits.IsValid() || CompiledCredits->Lines.Num() == 0 || CompiledCredits->Lines.SectionStarts.Num() == 0)
+	{
+		return NAME_None;
+	}
+
+	const FCreditsLineTable& Lines = CompiledCredits->Lines;
+	int32 FirstLine;
+	int32 EndLine;
+	const float Offset = GetScrollOffset();
+	Lines.FindLineRange(Offset, Offset + 1.0f, FirstLine, EndLine);
+	return Lines.SectionNames[Lines.FindSectionOfLine(FMath::Min(FirstLine, Lines.Num() - 1))];
+}
+
+void UCreditsVirtualRoller::SetScrollSpeed(float InScrollSpeed)
+{
+	ScrollSpeed = InScrollSpeed;
+
+	if (MyRoller.IsValid())
+	{
+		MyRoller->SetScrollSpeed(ScrollSpeed);
+	}
+	if (MyPainter.IsValid())
+	{
+		MyPainter->SetScrollSpeed(ScrollSpeed);
+	}
+}
+
+float UCreditsVirtualRoller::GetScrollOffset() const
+{
+	// the Slate widgets move on by themselves while a scroll speed is set.
+	if (MyRoller.IsValid())
+	{
+		return MyRoller->GetScrollOffset();
+	}
+	if (MyPainter.IsValid())
+	{
+		return MyPainter->GetScrollOffset();
+	}
+	return ScrollOffset;
+}
+
+float UCreditsVirtualRoller::GetTotalHeight() const
+{
+	return CompiledCredits.IsValid() ? CompiledCredits->Lines.TotalHeight : 0.0f;
+}
+
+int32 UCreditsVirtualRoller::GetNumLiveWidgets() const
+{
+	return MyRoller.IsValid() ? MyRoller->GetNumLiveWidgets() : 0;
+}
+
+void UCreditsVirtualRoller::SetOwnedCompiledCredits(const TSharedRef<FCreditsCompiledCredits>& Compiled)
+{
+	PackImages(*Compiled);
+	SetCompiledCredits(Compiled);
+
+	AssetStreamer = MakeShared<FCreditsAssetStreamer>(Compiled);
+	UpdateAssetStreamer();
+}
+
+void UCreditsVirtualRoller::PackImages(FCreditsCompiledCredits& Compiled)
+{
+	if (ImageAtlas)
+	{
+		FCreditsImageAtlas::Apply(Compiled, ImageAtlas);
+	}
+	else if (bBuildImageAtlas)
+	{
+		FCreditsImageAtlas::Build(Compiled);
+	}
+}
+
+void UCreditsVirtualRoller::HandleCreditsRecompiled(int32 FirstLine, bool bFullRecompile, const TArray<int32>& ImageRemap)
+{
+	if (bFullRecompile)
+	{
+		// every image was added again, the atlas pages and the streamer start over.
+		const TSharedRef<FCreditsCompiledCredits> Compiled = LiveCompiler->GetCompiledCredits();
+		PackImages(*Compiled);
+		AssetStreamer = MakeShared<FCreditsAssetStreamer>(Compiled);
+	}
+	else if (AssetStreamer.IsValid())
+	{
+		// the handles follow their images before the streamer reads the lines again.
+		if (ImageRemap.Num() > 0)
+		{
+			AssetStreamer->RemapImages(ImageRemap);
+		}
+
+		// images a recompiled section added are shown on their own, the atlas is only packed on a full recompile.
+		AssetStreamer->RefreshExtents();
+	}
+	UpdateAssetStreamer();
+
+	if (MyRoller.IsValid())
+	{
+		MyRoller->RefreshLines(bFullRecompile ? 0 : FirstLine);
+	}
+	if (MyPainter.IsValid())
+	{
+		MyPainter->RefreshLines(bFullRecompile ? 0 : FirstLine);
+	}
+}
+
+void UCreditsVirtualRoller::UpdateAssetStreamer()
+{
+	if (AssetStreamer.IsValid())
+	{
+		AssetStreamer->SetWindow(StreamingLookahead, ViewportMargin);
+		AssetStreamer->Update(ScrollOffset, GetCachedGeometry().GetLocalSize().Y, FApp::GetDeltaTime());
+	}
+}
+
+void UCreditsVirtualRoller::UpdateLazyCompiler()
+{
+	if (!LazyCompiler.IsValid())
+	{
+		return;
+	}
+
+	// before the first paint the viewport has no height, the lookahead still covers the first screen.
+	const float ViewportHeight = GetCachedGeometry().GetLocalSize().Y;
+	const FCreditsLazyUpdate Update = LazyCompiler->Update(ScrollOffset, ScrollOffset - ViewportMargin, ScrollOffset + ViewportHeight + ViewportMargin + LazyLookahead);
+	if (Update.FirstLine == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (bPrewarmGlyphs)
+	{
+		const FCreditsCompiledCredits& Compiled = *LazyCompiler->GetCompiledCredits();
+		const float FontScale = GetCachedGeometry().Scale;
+		for (const int32 SectionIndex : Update.MaterializedSections)
+		{
+			int32 SectionStart, SectionEnd;
+			Compiled.Lines.GetSectionRange(SectionIndex, SectionStart, SectionEnd);
+			FCreditsGlyphPrewarm::PrewarmLines(Compiled, SectionStart, SectionEnd, FontScale > 0.0f ? FontScale : 1.0f);
+		}
+	}
+	HandleCreditsRecompiled(Update.FirstLine, false, Update.ImageRemap);
+}
+
+void UCreditsVirtualRoller::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyRoller.Reset();
+	MyPainter.Reset();
+}
+
+#if WITH_EDITOR
+const FText UCreditsVirtualRoller::GetPaletteCategory()
+{
+	return LOCTEXT("CreditsPaletteCategory", "Credits");
+}
+#endif
+
+TSharedRef<SWidget> UCreditsVirtualRoller::RebuildWidget()
+{
+	MyRoller.Reset();
+	MyPainter.Reset();
+
+	if (RenderMode == ECreditsRenderMode::Painter)
+	{
+		MyPainter = SNew(SCreditsLinePainter);
+		return MyPainter.ToSharedRef();
+	}
+
+	MyRoller = SNew(SCreditsVirtualRoller)
+		.ViewportMargin(ViewportMargin);
+
+	return MyRoller.ToSharedRef();
+}
+
+void UCreditsVirtualRoller::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+
+	if (MyRoller.IsValid())
+	{
+		MyRoller->SetViewportMargin(ViewportMargin);
+		MyRoller->SetCompiledCredits(CompiledCredits);
+		MyRoller->SetScrollOffset(ScrollOffset);
+		MyRoller->SetScrollSpeed(ScrollSpeed);
+	}
+	if (MyPainter.IsValid())
+	{
+		MyPainter->SetCompiledCredits(CompiledCredits);
+		MyPainter->SetScrollOffset(ScrollOffset);
+		MyPainter->SetScrollSpeed(ScrollSpeed);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
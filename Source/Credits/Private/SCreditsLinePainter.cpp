@@ -0,0 +1,174 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "SCreditsLinePainter.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "CreditsCompiler.h"
+#include "CreditsStats.h"
+
+SCreditsLinePainter::SCreditsLinePainter()
+	: ScrollOffset(0.0f)
+	, ScrollSpeed(0.0f)
+	, NumPaintedLines(0)
+{
+}
+
+void SCreditsLinePainter::Construct(const FArguments& InArgs)
+{
+}
+
+void SCreditsLinePainter::SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCredits)
+{
+	if (Credits == InCredits)
+	{
+		return;
+	}
+
+	Credits = InCredits;
+	TextWidths.Reset();
+	if (Credits.IsValid())
+	{
+		TextWidths.Init(-1.0f, Credits->Lines.Num());
+	}
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SCreditsLinePainter::RefreshLines(int32 FirstLine)
+{
+	if (!Credits.IsValid())
+	{
+		return;
+	}
+
+	TextWidths.SetNum(Credits->Lines.Num());
+	for (int32 Line = FMath::Max(0, FirstLine); Line < TextWidths.Num(); ++Line)
+	{
+		TextWidths[Line] = -1.0f;
+	}
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SCreditsLinePainter::SetScrollOffset(float InScrollOffset)
+{
+	if (ScrollOffset != InScrollOffset)
+	{
+		ScrollOffset = InScrollOffset;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+}
+
+void SCreditsLinePainter::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SLeafWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// whoever drives the scrolling may update less often than every frame, the offset moves on in between.
+	if (ScrollSpeed != 0.0f && Credits.IsValid())
+	{
+		SetScrollOffset(ScrollOffset + ScrollSpeed * InDeltaTime);
+	}
+}
+
+int32 SCreditsLinePainter::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsPaint);
+
+	NumPaintedLines = 0;
+	if (!Credits.IsValid())
+	{
+		return LayerId;
+	}
+
+	const FCreditsLineTable& Lines = Credits->Lines;
+	const FVector2D ViewSize = AllottedGeometry.GetLocalSize();
+	const float Bottom = ScrollOffset + ViewSize.Y;
+	const ESlateDrawEffect DrawEffects = ShouldBeEnabled(bParentEnabled) ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
+	const FLinearColor Tint = InWidgetStyle.GetColorAndOpacityTint();
+
+	int32 First = 0;
+	int32 End = 0;
+	Lines.FindLineRange(ScrollOffset, Bottom, First, End);
+
+	// images go out as they are met, text is gathered so it can be drawn one style at a time.
+	const int32 ImageLayer = LayerId;
+	const int32 TextLayer = LayerId + 1;
+	VisibleTextLines.Reset();
+
+	for (int32 Line = First; Line < End; ++Line)
+	{
+		// the names above a tall side role come with it, though they are scrolled out already.
+		if (Lines.OffsetsY[Line] + Lines.Heights[Line] <= ScrollOffset)
+		{
+			continue;
+		}
+		if (Lines.Kinds[Line] != ECreditsLineKind::Image)
+		{
+			VisibleTextLines.Add(Line);
+			continue;
+		}
+
+		FVector2D Position;
+		FVector2D Size;
+		Credits->GetLineContentRect(Line, ViewSize.X, Position, Size);
+		Position.Y -= ScrollOffset;
+
+		const FSlateBrush& Brush = Credits->ImageBrushes[Lines.ImageIndices[Line]];
+		FSlateDrawElement::MakeBox(OutDrawElements, ImageLayer, AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)), &Brush, DrawEffects, Tint * Brush.GetTint(InWidgetStyle));
+		++NumPaintedLines;
+	}
+
+	VisibleTextLines.Sort([&Lines](int32 A, int32 B)
+	{
+		return Lines.StyleIndices[A] != Lines.StyleIndices[B] ? Lines.StyleIndices[A] < Lines.StyleIndices[B] : A < B;
+	});
+
+	for (const int32 Line : VisibleTextLines)
+	{
+		const uint16 StyleIndex = Lines.StyleIndices[Line];
+		const uint8 LineFlags = Lines.Flags[Line];
+
+		FVector2D Position;
+		FVector2D Size;
+		Credits->GetLineContentRect(Line, ViewSize.X, Position, Size);
+		Position.Y -= ScrollOffset;
+
+		// side roles hug the gutter from the left, their names from the right, everything else is centered.
+		if (!(LineFlags & ECreditsLineFlags::NameColumn))
+		{
+			const float Slack = FMath::Max(0.0f, Size.X - GetTextWidth(Line));
+			Position.X += (LineFlags & ECreditsLineFlags::SideColumn) ? Slack : Slack * 0.5f;
+		}
+
+		const int32 Start = Lines.TextStarts[Line];
+		FSlateDrawElement::MakeText(OutDrawElements, TextLayer, AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)), Lines.StringPool, Start, Start + Lines.TextLengths[Line], Credits->Styles.GetFontInfo(StyleIndex), DrawEffects, Tint * Credits->Styles[StyleIndex].Color);
+		++NumPaintedLines;
+	}
+
+	INC_DWORD_STAT_BY(STAT_CreditsVisibleLines, NumPaintedLines);
+	return TextLayer;
+}
+
+FVector2D SCreditsLinePainter::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// the painter fills whatever it is given, the credits scroll through it.
+	return FVector2D::ZeroVector;
+}
+
+float SCreditsLinePainter::GetTextWidth(int32 Line) const
+{
+	if (Credits->Lines.bMeasured)
+	{
+		return Credits->Lines.Widths[Line];
+	}
+
+	float& Width = TextWidths[Line];
+	if (Width < 0.0f)
+	{
+		const FCreditsLineTable& Lines = Credits->Lines;
+		const int32 Start = Lines.TextStarts[Line];
+		const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+		Width = FontMeasure->Measure(Lines.StringPool, Start, Start + Lines.TextLengths[Line], Credits->Styles.GetFontInfo(Lines.StyleIndices[Line])).X;
+	}
+	return Width;
+}
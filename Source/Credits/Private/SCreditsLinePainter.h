@@ -0,0 +1,85 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class FCreditsCompiledCredits;
+
+/**
+ * Batched closing credits painter.
+ * A single leaf widget that draws the visible lines straight from the compiled credits, without a widget per line.
+ * Images are drawn on one layer and text on the next, with text lines grouped by style so that lines sharing
+ * a font end up in the same element batch.
+ */
+class SCreditsLinePainter : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SCreditsLinePainter)
+		{
+			_Visibility = EVisibility::HitTestInvisible;
+		}
+	SLATE_END_ARGS()
+
+	SCreditsLinePainter();
+
+	void Construct(const FArguments& InArgs);
+
+	/** Sets the credits to paint. */
+	void SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCredits);
+
+	/** Forgets what was cached for the lines from FirstLine on, after the credits changed in place. */
+	void RefreshLines(int32 FirstLine);
+
+	/** Sets the credits-space Y shown at the top of the viewport. */
+	void SetScrollOffset(float InScrollOffset);
+
+	/** Returns the credits-space Y shown at the top of the viewport. */
+	float GetScrollOffset() const
+	{
+		return ScrollOffset;
+	}
+
+	/** Sets the speed at which the scroll offset advances every frame until it is set again, in units per second. */
+	void SetScrollSpeed(float InScrollSpeed)
+	{
+		ScrollSpeed = InScrollSpeed;
+	}
+
+	/** Returns the number of lines painted by the last paint. */
+	int32 GetNumPaintedLines() const
+	{
+		return NumPaintedLines;
+	}
+
+	//~ Begin SWidget Interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	//~ End SWidget Interface
+
+private:
+
+	/** Returns the width of the text of Line, measuring it the first time it is painted when the layout was estimated. */
+	float GetTextWidth(int32 Line) const;
+
+	/** reference to the compiled credits being painted. */
+	TSharedPtr<const FCreditsCompiledCredits> Credits;
+
+	/** reference to the width of each text line measured while painting, negative until measured. */
+	mutable TArray<float> TextWidths;
+
+	/** reference to the visible text lines of the current paint, sorted by style. */
+	mutable TArray<int32> VisibleTextLines;
+
+	/** reference to the credits-space Y shown at the top of the viewport. */
+	float ScrollOffset;
+
+	/** reference to the speed at which the scroll offset advances every frame. */
+	float ScrollSpeed;
+
+	/** reference to the number of lines painted by the last paint. */
+	mutable int32 NumPaintedLines;
+};
@@ -0,0 +1,246 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "SCreditsVirtualRoller.h"
+#include "Layout/ArrangedChildren.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Text/STextBlock.h"
+#include "CreditsCompiler.h"
+#include "CreditsStats.h"
+
+SCreditsVirtualRoller::SCreditsVirtualRoller()
+	: Children(this)
+	, ScrollOffset(0.0f)
+	, ScrollSpeed(0.0f)
+	, ViewportMargin(200.0f)
+	, NumCreatedWidgets(0)
+{
+}
+
+SCreditsVirtualRoller::~SCreditsVirtualRoller()
+{
+	DEC_DWORD_STAT_BY(STAT_CreditsLiveWidgets, LiveLines.Num());
+}
+
+void SCreditsVirtualRoller::Construct(const FArguments& InArgs)
+{
+	ViewportMargin = FMath::Max(0.0f, InArgs._ViewportMargin);
+}
+
+void SCreditsVirtualRoller::SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCredits)
+{
+	if (Credits == InCredits)
+	{
+		return;
+	}
+
+	ReleaseAllLines();
+	Credits = InCredits;
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+void SCreditsVirtualRoller::RefreshLines(int32 FirstLine)
+{
+	// the kept lines are unchanged, the live range then no longer matches so the next tick fills the gaps.
+	LiveLines.RemoveAll([this, FirstLine](const FLiveLine& LiveLine)
+	{
+		const bool bRelease = LiveLine.bImage || LiveLine.Line >= FirstLine;
+		if (bRelease)
+		{
+			ReleaseWidget(LiveLine);
+		}
+		return bRelease;
+	});
+
+	Children.Empty();
+	for (const FLiveLine& LiveLine : LiveLines)
+	{
+		Children.Add(LiveLine.Widget);
+	}
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+void SCreditsVirtualRoller::SetScrollOffset(float InScrollOffset)
+{
+	if (ScrollOffset != InScrollOffset)
+	{
+		ScrollOffset = InScrollOffset;
+		Invalidate(EInvalidateWidgetReason::Layout);
+	}
+}
+
+void SCreditsVirtualRoller::SetViewportMargin(float InViewportMargin)
+{
+	ViewportMargin = FMath::Max(0.0f, InViewportMargin);
+}
+
+void SCreditsVirtualRoller::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SPanel::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (!Credits.IsValid())
+	{
+		return;
+	}
+
+	// whoever drives the scrolling may update less often than every frame, the offset moves on in between.
+	if (ScrollSpeed != 0.0f)
+	{
+		SetScrollOffset(ScrollOffset + ScrollSpeed * InDeltaTime);
+	}
+
+	const float ViewportHeight = AllottedGeometry.GetLocalSize().Y;
+	UpdateLiveLines(ScrollOffset - ViewportMargin, ScrollOffset + ViewportHeight + ViewportMargin);
+	INC_DWORD_STAT_BY(STAT_CreditsVisibleLines, LiveLines.Num());
+}
+
+void SCreditsVirtualRoller::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	if (!Credits.IsValid())
+	{
+		return;
+	}
+
+	const float ViewWidth = AllottedGeometry.GetLocalSize().X;
+	for (const FLiveLine& LiveLine : LiveLines)
+	{
+		FVector2D Position;
+		FVector2D Size;
+		Credits->GetLineContentRect(LiveLine.Line, ViewWidth, Position, Size);
+		Position.Y -= ScrollOffset;
+
+		ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(LiveLine.Widget, Position, Size));
+	}
+}
+
+FVector2D SCreditsVirtualRoller::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// the roller fills whatever it is given, the credits scroll through it.
+	return FVector2D::ZeroVector;
+}
+
+FChildren* SCreditsVirtualRoller::GetChildren()
+{
+	return &Children;
+}
+
+void SCreditsVirtualRoller::UpdateLiveLines(float Top, float Bottom)
+{
+	CREDITS_SCOPE_CYCLE_COUNTER(STAT_CreditsUpdateWidgets);
+	LLM_SCOPE_BYTAG(Credits);
+
+	const FCreditsLineTable& Lines = Credits->Lines;
+
+	int32 First = 0;
+	int32 End = 0;
+	Lines.FindLineRange(Top, Bottom, First, End);
+
+	// nothing scrolled in or out, keep the current widgets.
+	if (LiveLines.Num() == End - First && (LiveLines.Num() == 0 || LiveLines[0].Line == First))
+	{
+		return;
+	}
+
+	TArray<FLiveLine> PreviousLines = MoveTemp(LiveLines);
+	LiveLines.Reset(End - First);
+
+	// both ranges are sorted, so lines that stay visible keep their widget.
+	int32 PreviousIndex = 0;
+	for (int32 Line = First; Line < End; ++Line)
+	{
+		while (PreviousIndex < PreviousLines.Num() && PreviousLines[PreviousIndex].Line < Line)
+		{
+			ReleaseWidget(PreviousLines[PreviousIndex]);
+			++PreviousIndex;
+		}
+
+		if (PreviousIndex < PreviousLines.Num() && PreviousLines[PreviousIndex].Line == Line)
+		{
+			LiveLines.Add(PreviousLines[PreviousIndex]);
+			++PreviousIndex;
+		}
+		else
+		{
+			LiveLines.Add(FLiveLine{ Line, AcquireWidget(Line), Lines.Kinds[Line] == ECreditsLineKind::Image });
+		}
+	}
+	for (; PreviousIndex < PreviousLines.Num(); ++PreviousIndex)
+	{
+		ReleaseWidget(PreviousLines[PreviousIndex]);
+	}
+
+	Children.Empty();
+	for (const FLiveLine& LiveLine : LiveLines)
+	{
+		Children.Add(LiveLine.Widget);
+	}
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
+
+TSharedRef<SWidget> SCreditsVirtualRoller::AcquireWidget(int32 Line)
+{
+	INC_DWORD_STAT(STAT_CreditsLiveWidgets);
+	const FCreditsLineTable& Lines = Credits->Lines;
+	const uint16 StyleIndex = Lines.StyleIndices[Line];
+
+	if (Lines.Kinds[Line] == ECreditsLineKind::Image)
+	{
+		TSharedPtr<SImage> Image;
+		if (ImagePool.Num() > 0)
+		{
+			Image = ImagePool.Pop(false);
+		}
+		else
+		{
+			Image = SNew(SImage);
+			++NumCreatedWidgets;
+		}
+
+		Image->SetImage(&Credits->ImageBrushes[Lines.ImageIndices[Line]]);
+		return Image.ToSharedRef();
+	}
+
+	TSharedPtr<STextBlock> Text;
+	if (TextPool.Num() > 0)
+	{
+		Text = TextPool.Pop(false);
+	}
+	else
+	{
+		Text = SNew(STextBlock);
+		++NumCreatedWidgets;
+	}
+
+	const uint8 LineFlags = Lines.Flags[Line];
+	const ETextJustify::Type Justification = (LineFlags & ECreditsLineFlags::SideColumn) ? ETextJustify::Right : (LineFlags & ECreditsLineFlags::NameColumn) ? ETextJustify::Left : ETextJustify::Center;
+
+	Text->SetText(FText::FromStringView(Lines.GetText(Line)));
+	Text->SetFont(Credits->Styles.GetFontInfo(StyleIndex));
+	Text->SetColorAndOpacity(FSlateColor(Credits->Styles[StyleIndex].Color));
+	Text->SetJustification(Justification);
+	return Text.ToSharedRef();
+}
+
+void SCreditsVirtualRoller::ReleaseWidget(const FLiveLine& LiveLine)
+{
+	DEC_DWORD_STAT(STAT_CreditsLiveWidgets);
+	if (LiveLine.bImage)
+	{
+		ImagePool.Add(StaticCastSharedRef<SImage>(LiveLine.Widget));
+	}
+	else
+	{
+		TextPool.Add(StaticCastSharedRef<STextBlock>(LiveLine.Widget));
+	}
+}
+
+void SCreditsVirtualRoller::ReleaseAllLines()
+{
+	for (const FLiveLine& LiveLine : LiveLines)
+	{
+		ReleaseWidget(LiveLine);
+	}
+
+	LiveLines.Reset();
+	Children.Empty();
+	Invalidate(EInvalidateWidgetReason::ChildOrder);
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SPanel.h"
+#include "Layout/Children.h"
+
+class FCreditsCompiledCredits;
+class SImage;
+class STextBlock;
+
+/**
+ * Virtualized closing credits roller.
+ * Only lines inside the viewport, plus a margin above and below it, own a widget. Widgets of lines
+ * that scroll out are returned to a pool and reused for the lines scrolling in, so the number of live
+ * widgets depends on the viewport height and never on the length of the credits.
+ */
+class SCreditsVirtualRoller : public SPanel
+{
+public:
+
+	SLATE_BEGIN_ARGS(SCreditsVirtualRoller)
+		: _ViewportMargin(200.0f)
+		{
+			_Visibility = EVisibility::SelfHitTestInvisible;
+		}
+
+		/** Extra distance above and below the viewport in which lines keep their widgets. */
+		SLATE_ARGUMENT(float, ViewportMargin)
+
+	SLATE_END_ARGS()
+
+	SCreditsVirtualRoller();
+	virtual ~SCreditsVirtualRoller();
+
+	void Construct(const FArguments& InArgs);
+
+	/** Sets the credits to roll, releasing every live line widget. */
+	void SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCredits);
+
+	/**
+	 * Releases the live widgets of the lines from FirstLine on, after the credits changed in place, and every live
+	 * image widget as the image brushes may have moved. The next tick acquires widgets for them again.
+	 */
+	void RefreshLines(int32 FirstLine);
+
+	/** Sets the credits-space Y shown at the top of the viewport. */
+	void SetScrollOffset(float InScrollOffset);
+
+	/** Returns the credits-space Y shown at the top of the viewport. */
+	float GetScrollOffset() const
+	{
+		return ScrollOffset;
+	}
+
+	/** Sets the speed at which the scroll offset advances every frame until it is set again, in units per second. */
+	void SetScrollSpeed(float InScrollSpeed)
+	{
+		ScrollSpeed = InScrollSpeed;
+	}
+
+	/** Sets the extra distance above and below the viewport in which lines keep their widgets. */
+	void SetViewportMargin(float InViewportMargin);
+
+	/** Returns the number of line widgets currently in use. */
+	int32 GetNumLiveWidgets() const
+	{
+		return LiveLines.Num();
+	}
+
+	/** Returns the number of line widgets created so far, in use or pooled. */
+	int32 GetNumCreatedWidgets() const
+	{
+		return NumCreatedWidgets;
+	}
+
+	//~ Begin SWidget Interface
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	virtual FChildren* GetChildren() override;
+	//~ End SWidget Interface
+
+private:
+
+	/** Simple struct for a line currently owning a widget. */
+	struct FLiveLine
+	{
+		/** reference to the line in the line table. */
+		int32 Line;
+
+		/** reference to the widget showing the line. */
+		TSharedRef<SWidget> Widget;
+
+		/** reference to whether the widget is an image, rather than a text. */
+		bool bImage;
+	};
+
+	/** Brings the live lines in sync with the lines overlapping [Top, Bottom). */
+	void UpdateLiveLines(float Top, float Bottom);
+
+	/** Creates or reuses a widget for Line. */
+	TSharedRef<SWidget> AcquireWidget(int32 Line);
+
+	/** Returns the widget of a line that scrolled out to its pool. */
+	void ReleaseWidget(const FLiveLine& LiveLine);
+
+	/** Returns every live widget to the pools. */
+	void ReleaseAllLines();
+
+	/** reference to the compiled credits being rolled. */
+	TSharedPtr<const FCreditsCompiledCredits> Credits;
+
+	/** reference to the widgets arranged this frame. */
+	TSlotlessChildren<SWidget> Children;
+
+	/** reference to the lines owning a widget, sorted by line. */
+	TArray<FLiveLine> LiveLines;
+
+	/** reference to the pooled text widgets. */
+	TArray<TSharedRef<STextBlock>> TextPool;
+
+	/** reference to the pooled image widgets. */
+	TArray<TSharedRef<SImage>> ImagePool;
+
+	/** reference to the credits-space Y shown at the top of the viewport. */
+	float ScrollOffset;
+
+	/** reference to the speed at which the scroll offset advances every frame. */
+	float ScrollSpeed;
+
+	/** reference to the extra distance kept alive above and below the viewport. */
+	float ViewportMargin;
+
+	/** reference to the number of line widgets created so far. */
+	int32 NumCreatedWidgets;
+};
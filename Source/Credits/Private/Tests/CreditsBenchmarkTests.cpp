@@ -0,0 +1,65 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+#include "CreditsBenchmarkCommandlet.h"
+#include "CreditsSynthetic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Runs the data-scale benchmark for every run of the baseline of the plugin and fails on any regression against it.
+ * It runs headless, along the rest of the performance tests:
+ *
+ *   UnrealEditor-Cmd <Project> -nullrhi -ExecCmds="Automation RunTests Credits.Benchmark; Quit"
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCreditsBenchmarkScaleTest, "Credits.Benchmark.Scale", EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter)
+
+bool FCreditsBenchmarkScaleTest::RunTest(const FString& Parameters)
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("Credits"));
+	if (!TestTrue(TEXT("The Credits plugin is found"), Plugin.IsValid()))
+	{
+		return false;
+	}
+
+	const FString BaselineFile = Plugin->GetBaseDir() / TEXT("Benchmarks") / TEXT("CreditsBenchmarkBaseline.csv");
+	TArray<FCreditsScaleResult> Baseline;
+	if (!TestTrue(FString::Printf(TEXT("The baseline %s is read"), *BaselineFile), UCreditsBenchmarkCommandlet::ReadCsv(BaselineFile, Baseline) && Baseline.Num() > 0))
+	{
+		return false;
+	}
+
+	// from the smallest run up, so each run can raise the high water mark its peak memory is read from.
+	Baseline.Sort([](const FCreditsScaleResult& A, const FCreditsScaleResult& B)
+	{
+		return A.NumNames < B.NumNames;
+	});
+
+	TArray<FCreditsScaleResult> Results;
+	for (const FCreditsScaleResult& Base : Baseline)
+	{
+		FCreditsSyntheticSettings Settings;
+		Settings.NumNames = Base.NumNames;
+		Settings.OverrideDensity = Base.OverrideDensity;
+		Settings.ImageRatio = Base.ImageRatio;
+		const FCreditsScaleResult& Result = Results.Add_GetRef(UCreditsBenchmarkCommandlet::RunScale(Settings));
+		AddInfo(FString::Printf(TEXT("%d names: convert %.3f ms, compile %.3f ms, layout %.3f ms, peak memory %.1f MB, compiled %.1f KB, binary %.1f KB"),
+			Result.NumNames, Result.ConvertMs, Result.CompileMs, Result.LayoutMs, Result.PeakMemoryMB, Result.CompiledKB, Result.BinaryKB));
+
+		// the synthetic sections of a run must match the baseline, or the baseline is of other credits.
+		if (Base.NumSections > 0)
+		{
+			TestEqual(FString::Printf(TEXT("Sections of %d names"), Base.NumNames), Result.NumSections, Base.NumSections);
+		}
+
+		// the next run starts from the memory this one held.
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	TestEqual(TEXT("Regressions against the baseline"), UCreditsBenchmarkCommandlet::CompareToBaseline(Results, Baseline, 0.2f), 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Sound/SoundWave.h"
+#include "CreditsMusic.h"
+#include "CreditsTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Plays 24 tracks of uneven length through the music queue on the audio device of a game world, over 60 fps frames
+ * with a hitch every few seconds, and checks that every track is handed to the renderer ahead of time, to start
+ * within a tick of the end of the track before it. It needs an audio device, the null one of -nullrhi is enough.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCreditsMusicGapTest, "Credits.Music.Gap", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCreditsMusicGapTest::RunTest(const FString& Parameters)
+{
+	const int32 NumTracks = 24;
+	const double MaxGap = 1.0 / FCreditsMusicQueue::TicksPerSecond;
+
+	FCreditsTestWorld TestWorld;
+	if (!TestNotNull(TEXT("Audio device"), TestWorld.World->GetAudioDeviceRaw()))
+	{
+		return false;
+	}
+
+	TArray<FCreditsMusic> Music;
+	FRandomStream Random(NumTracks);
+	for (int32 Index = 0; Index < NumTracks; ++Index)
+	{
+		USoundWave* Wave = NewObject<USoundWave>(GetTransientPackage());
+		Wave->Duration = Random.FRandRange(0.5f, 3.0f);
+
+		const ECreditsSoundQueueMode QueueMode = Index % 8 == 7 ? ECreditsSoundQueueMode::SkipAudio : ECreditsSoundQueueMode::AfterPreviousAudio;
+		const float StartTime = Index % 4 == 0 ? Random.FRandRange(0.0f, 0.25f) : 0.0f;
+		Music.Emplace(Wave, QueueMode, StartTime, 0.0f);
+	}
+
+	FCreditsMusicQueue Queue;
+	Queue.Start(TestWorld.World, Music, false);
+	if (!TestTrue(TEXT("The queue started"), Queue.IsQueueing()))
+	{
+		return false;
+	}
+
+	// the hitches stay below the lookahead, as a frame longer than it is late whatever the clock.
+	int32 NumFrames = 0;
+	while (Queue.IsQueueing() || Queue.IsPlaying())
+	{
+		const float DeltaTime = ++NumFrames % 180 == 0 ? 0.5f : 1.0f / 60.0f;
+		TestWorld.Tick(DeltaTime);
+		Queue.Update(DeltaTime);
+		if (!TestTrue(TEXT("The queue ends"), NumFrames < 60 * 120))
+		{
+			break;
+		}
+	}
+	Queue.Stop();
+
+	const FCreditsMusicTrack* Previous = nullptr;
+	int32 NumTransitions = 0;
+	for (const FCreditsMusicTrack& Track : Queue.GetTracks())
+	{
+		if (Track.QueueMode == ECreditsSoundQueueMode::SkipAudio)
+		{
+			TestFalse(TEXT("A Skip Audio track is not queued"), Track.IsQueued());
+			continue;
+		}
+		if (!TestTrue(TEXT("The track was scheduled"), Track.StartTick >= 0.0))
+		{
+			continue;
+		}
+
+		if (Previous)
+		{
+			const double Gap = FMath::Abs(Track.StartTick / FCreditsMusicQueue::TicksPerSecond - Previous->GetEnd());
+			TestTrue(FString::Printf(TEXT("Gap of %.3f ms before a track"), Gap * 1000.0), Gap <= MaxGap);
+			++NumTransitions;
+		}
+		Previous = &Track;
+	}
+	TestTrue(TEXT("Transitions"), NumTransitions > 0);
+	return true;
+}
+
+#endif
@@ -0,0 +1,125 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "CreditsMusic.h"
+#include "CreditsSpawner.h"
+#include "CreditsTestWorld.h"
+#include "CreditsVirtualRoller.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Spawns 1000 credits spawners in a game world, ticks it a few frames and checks that none of them has an enabled
+ * tick while no roll is active, nor once a roll was started and stopped again.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCreditsIdleSpawnersTest, "Credits.Spawner.Idle", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCreditsIdleSpawnersTest::RunTest(const FString& Parameters)
+{
+	const int32 NumSpawners = 1000;
+
+	FCreditsTestWorld TestWorld;
+	TArray<ACreditsSpawner*> Spawners;
+	Spawners.Reserve(NumSpawners);
+	for (int32 Index = 0; Index < NumSpawners; ++Index)
+	{
+		Spawners.Add(TestWorld.World->SpawnActor<ACreditsSpawner>());
+	}
+	for (int32 Frame = 0; Frame < 3; ++Frame)
+	{
+		TestWorld.Tick(1.0f / 60.0f);
+	}
+
+	auto CountTicking = [&Spawners]()
+	{
+		int32 NumTicking = 0;
+		for (const ACreditsSpawner* Spawner : Spawners)
+		{
+			NumTicking += Spawner && Spawner->IsActorTickEnabled() ? 1 : 0;
+		}
+		return NumTicking;
+	};
+	TestEqual(TEXT("Idle spawners with an enabled tick"), CountTicking(), 0);
+
+	// a roll without music leaves nothing to tick for once it stops.
+	ACreditsSpawner* Spawner = Spawners[0];
+	Spawner->GeneralSettings.AutoPlayMusic = false;
+	Spawner->StartRoll(NewObject<UCreditsVirtualRoller>(GetTransientPackage()));
+	TestTrue(TEXT("A rolling spawner ticks"), Spawner->IsActorTickEnabled());
+	TestWorld.Tick(1.0f / 60.0f);
+	Spawner->StopRoll();
+	TestEqual(TEXT("Spawners with an enabled tick after a roll"), CountTicking(), 0);
+
+	for (ACreditsSpawner* Each : Spawners)
+	{
+		if (Each)
+		{
+			Each->Destroy();
+		}
+	}
+	return true;
+}
+
+/**
+ * Rolls a spawner synced to the music through a 15 minute roll of 60 fps frames with hitches and stretches of time
+ * dilation, against a music clock taking the playback time the audio renderer reports once per 1024 sample buffer,
+ * and checks that the roll time never drifts from the music by more than the tolerance.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCreditsMusicDriftTest, "Credits.Spawner.MusicDrift", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCreditsMusicDriftTest::RunTest(const FString& Parameters)
+{
+	const double RollSeconds = 15.0 * 60.0;
+	const double BufferSeconds = 1024.0 / 48000.0;
+	const double Tolerance = 0.05;
+
+	FCreditsTestWorld TestWorld;
+	ACreditsSpawner* Spawner = TestWorld.World->SpawnActor<ACreditsSpawner>();
+	if (!TestNotNull(TEXT("Spawner"), Spawner))
+	{
+		return false;
+	}
+
+	// the roll is dilated with the game, so only the music clock keeps it on the soundtrack.
+	Spawner->bSyncToMusic = true;
+	Spawner->GeneralSettings.AutoPlayMusic = false;
+	Spawner->GeneralSettings.TimeDilationEffectsCredits = true;
+	Spawner->StartRoll(NewObject<UCreditsVirtualRoller>(GetTransientPackage()));
+
+	FRandomStream Random((int32)RollSeconds);
+	FCreditsPlaybackClock MusicClock;
+	double AudioTime = 0.0;
+	double MaxDrift = 0.0;
+	double NextHitch = Random.FRandRange(5.0f, 15.0f);
+	int32 NumHitches = 0;
+	while (AudioTime < RollSeconds)
+	{
+		double DeltaTime = Random.FRandRange(1.0f / 65.0f, 1.0f / 55.0f);
+		if (AudioTime >= NextHitch)
+		{
+			DeltaTime = Random.FRandRange(0.1f, 1.0f);
+			NextHitch += Random.FRandRange(5.0f, 15.0f);
+			++NumHitches;
+		}
+
+		// the game slows down for a minute every three minutes, the music does not.
+		const float TimeDilation = FMath::Fmod(AudioTime, 180.0) < 60.0 ? 0.8f : 1.0f;
+		AudioTime += DeltaTime;
+
+		// the last buffer rendered by the frame is the one reported, behind the audio by up to a buffer.
+		MusicClock.Advance(DeltaTime);
+		MusicClock.Sync(FMath::FloorToDouble(AudioTime / BufferSeconds) * BufferSeconds);
+
+		Spawner->TickRoll(DeltaTime * TimeDilation, TimeDilation, &MusicClock);
+		MaxDrift = FMath::Max(MaxDrift, FMath::Abs(Spawner->GetRollTime() - AudioTime));
+	}
+	Spawner->StopRoll();
+	Spawner->Destroy();
+
+	AddInfo(FString::Printf(TEXT("%d hitches, max drift %.3f s"), NumHitches, MaxDrift));
+	TestTrue(TEXT("Hitches"), NumHitches > 0);
+	TestTrue(FString::Printf(TEXT("Drift of %.3f s within %.3f s"), MaxDrift, Tolerance), MaxDrift <= Tolerance);
+	return true;
+}
+
+#endif
@@ -0,0 +1,42 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * A game world for the credits automation tests, playing from construction and destroyed with the struct, with the
+ * audio device of the engine, the null one when there is no audio hardware.
+ */
+struct FCreditsTestWorld
+{
+	FCreditsTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("CreditsTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FCreditsTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	/** Ticks the world DeltaTime seconds forward. */
+	void Tick(float DeltaTime)
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	/** reference to the world. */
+	UWorld* World;
+};
+
+#endif
@@ -0,0 +1,118 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+
+class FCreditsCompiledCredits;
+
+/**
+ * Streams the soft images of compiled credits in and out around the scroll position.
+ * Images are requested once they enter a window reaching from KeepBehindDistance above the viewport to
+ * LookaheadSeconds of scrolling below it, and released once they leave it, so only the images about to
+ * be shown are resident whatever the credits length. The images are kept in order of where they are shown, so an
+ * update only looks at the ones around the window and the ones around the previous window. Until an image is streamed in its brush draws nothing.
+ * Hard images are owned by the credits structs and stay resident.
+ */
+class CREDITS_API FCreditsAssetStreamer
+{
+public:
+
+	FCreditsAssetStreamer(const TSharedRef<FCreditsCompiledCredits>& InCredits);
+	~FCreditsAssetStreamer();
+
+	/** Sets how far ahead, in seconds of scrolling at the current speed, and how far behind, in credits units, images stay resident. */
+	void SetWindow(float InLookaheadSeconds, float InKeepBehindDistance);
+
+	/**
+	 * Moves the window to the scroll position, requesting the images entering it and releasing the ones leaving it.
+	 * @param	ScrollOffset	The credits-space Y shown at the top of the viewport
+	 * @param	ViewportHeight	The height of the viewport
+	 * @param	DeltaTime		The time since the last update, used to derive the scroll speed
+	 */
+	void Update(float ScrollOffset, float ViewportHeight, float DeltaTime);
+
+	/** Notes the next update jumps rather than scrolls there, so the jump is not taken for the scroll speed. */
+	void NotifySeek()
+	{
+		bHasUpdated = false;
+	}
+
+	/** Recomputes where each soft image is shown, after the credits changed in place. */
+	void RefreshExtents();
+
+	/** Moves the handles along with the images after FCreditsCompiledCredits::CompactTables, dropping those of removed images. */
+	void RemapImages(const TArray<int32>& ImageRemap);
+
+	/** Releases every soft image. */
+	void ReleaseAll();
+
+	/** Returns the number of soft images currently requested. */
+	int32 GetNumResidentImages() const;
+
+	/** Returns the streamable manager of the asset manager, or a shared one when the asset manager is not initialized. */
+	static FStreamableManager& GetStreamableManager();
+
+private:
+
+	/** Requests the image at ImageIndex. */
+	void RequestImage(int32 ImageIndex);
+
+	/** Releases the image at ImageIndex, its brush drawing nothing until it is requested again. */
+	void ReleaseImage(int32 ImageIndex);
+
+#if STATS
+	/** Brings the loaded textures stat up to date with the soft images loaded, every frame as they load asynchronously. */
+	bool TickStats(float DeltaTime);
+
+	/** reference to the number of loaded soft images counted in the loaded textures stat. */
+	int32 NumLoadedStat;
+
+	/** reference to the handle of the stats ticker. */
+	FTSTicker::FDelegateHandle StatsTickerHandle;
+#endif
+
+	/** reference to the credits whose images are streamed. */
+	TSharedRef<FCreditsCompiledCredits> Credits;
+
+	/** reference to the top of the first line showing each image, FLT_MAX for hard images. */
+	TArray<float> ImageTops;
+
+	/** reference to the bottom of the last line showing each image. */
+	TArray<float> ImageBottoms;
+
+	/** reference to the soft images shown by a line, in order of their top. */
+	TArray<int32> SortedImages;
+
+	/** reference to the streaming handle of each image, set while the image is requested. */
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+
+	/** reference to the seconds of scrolling loaded ahead of the viewport. */
+	float LookaheadSeconds;
+
+	/** reference to the distance behind the viewport images stay resident. */
+	float KeepBehindDistance;
+
+	/** reference to the scroll offset of the last update. */
+	float LastScrollOffset;
+
+	/** reference to the smoothed scroll speed, in credits units per second. */
+	float ScrollSpeed;
+
+	/** reference to the longest extent of a soft image. */
+	float MaxImageExtent;
+
+	/** reference to the first entry of SortedImages looked at by the last update. */
+	int32 ActiveFirst;
+
+	/** reference to the entry of SortedImages past the last one looked at by the last update. */
+	int32 ActiveEnd;
+
+	/** reference to whether Update has run before. */
+	bool bHasUpdated;
+
+	/** reference to whether the extents were recomputed since the last update. */
+	bool bExtentsRefreshed;
+};
@@ -0,0 +1,77 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CreditsBenchmarkCommandlet.generated.h"
+
+struct FCreditsSyntheticSettings;
+
+/** Simple struct for closing credits measurements of one synthetic run. */
+struct CREDITS_API FCreditsScaleResult
+{
+	int32 NumNames = 0;
+	int32 NumSections = 0;
+	int32 NumLines = 0;
+	int32 NumStyles = 0;
+	float OverrideDensity = 0.0f;
+	float ImageRatio = 0.0f;
+
+	double ConvertMs = 0.0;
+	double CompileMs = 0.0;
+	double LayoutMs = 0.0;
+
+	/** whether the layout measured the text, rather than keeping the compiler estimates without a Slate renderer. */
+	bool bMeasured = false;
+
+	/** growth of the used physical memory over the run, at its highest, from the process high water mark when the run raised it. */
+	double PeakMemoryMB = 0.0;
+
+	double CompiledKB = 0.0;
+	double BinaryKB = 0.0;
+};
+
+/**
+ * Closing credits data-scale benchmark.
+ * Runs the credits pipeline over synthetic credits of 1k, 10k, 100k and 1M names, writes the conversion, compile and
+ * layout times, the peak memory and the compiled size of each run to CSV, and compares them to a baseline CSV of an
+ * earlier run, failing when any of them regressed by more than the tolerance. It runs headless:
+ *
+ *   UnrealEditor-Cmd <Project> -run=CreditsBenchmark -nullrhi [-Names=1000,10000] [-OverrideDensity=0.05]
+ *       [-ImageRatio=0.01] [-Output=<csv>] [-Baseline=<csv>] [-Tolerance=0.2]
+ *
+ * The baseline of the plugin is Benchmarks/CreditsBenchmarkBaseline.csv, which the Credits.Benchmark.Scale automation
+ * test also runs against. Its rows are budgets for each run, tightened by copying the output of a run on the reference
+ * machine over them; their line and style counts are 0 until then. A run without a row in the baseline is logged and
+ * not compared.
+ */
+UCLASS()
+class CREDITS_API UCreditsBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UCreditsBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer);
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+	/** Generates the synthetic credits of Settings and times each stage of the pipeline over them. */
+	static FCreditsScaleResult RunScale(const FCreditsSyntheticSettings& Settings);
+
+	/** Writes Results to Filename, one row per run. */
+	static bool WriteCsv(const TArray<FCreditsScaleResult>& Results, const FString& Filename);
+
+	/** Reads the results written by WriteCsv. */
+	static bool ReadCsv(const FString& Filename, TArray<FCreditsScaleResult>& OutResults);
+
+	/**
+	 * Logs every measurement of Results above the one of the baseline run with the same names and densities by more
+	 * than Tolerance, as a share of the baseline.
+	 * @return	The number of regressed measurements
+	 */
+	static int32 CompareToBaseline(const TArray<FCreditsScaleResult>& Results, const TArray<FCreditsScaleResult>& Baseline, float Tolerance);
+};
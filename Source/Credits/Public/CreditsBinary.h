@@ -0,0 +1,261 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include "Engine/StreamableManager.h"
+#include "CreditsLineTable.h"
+
+class FCreditsCompiledCredits;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Simple enum for the chunks of a closing credits binary file, in file order. */
+namespace ECreditsBinaryChunk
+{
+	enum Type : uint32
+	{
+		StringPool,
+		TextStarts,
+		TextLengths,
+		StyleIndices,
+		ImageIndices,
+		OffsetsY,
+		Widths,
+		Heights,
+		Kinds,
+		Flags,
+		SectionStarts,
+		SectionPaddingTop,
+		SectionPaddingBottom,
+		Styles,
+		Images,
+		AssetStarts,
+		AssetLengths,
+		AssetPool,
+		Num
+	};
+}
+
+/** Simple struct for the header of a closing credits binary file. */
+struct FCreditsBinaryHeader
+{
+	/** reference to the file magic, CreditsBinaryMagic. */
+	uint32 Magic;
+
+	/** reference to the format version, CreditsBinaryVersion. */
+	uint32 Version;
+
+	/** reference to the number of lines. */
+	int32 NumLines;
+
+	/** reference to the number of sections. */
+	int32 NumSections;
+
+	/** reference to the number of styles. */
+	int32 NumStyles;
+
+	/** reference to the number of images. */
+	int32 NumImages;
+
+	/** reference to the number of asset paths. */
+	int32 NumAssets;
+
+	/** reference to the number of characters in the string pool. */
+	int32 NumChars;
+
+	/** reference to the number of characters in the asset pool. */
+	int32 NumAssetChars;
+
+	/** reference to the height of the whole credits. */
+	float TotalHeight;
+
+	/** reference to whether the lines were measured. */
+	uint32 bMeasured;
+
+	/** reference to padding keeping the chunk table 8 byte aligned. */
+	uint32 Reserved;
+
+	/** reference to the byte offset of each chunk from the start of the file. */
+	uint64 ChunkOffsets[ECreditsBinaryChunk::Num];
+
+	/** reference to the byte size of each chunk. */
+	uint64 ChunkSizes[ECreditsBinaryChunk::Num];
+};
+
+/** Simple struct for a closing credits style as stored in a binary file, assets are indices into the asset table. */
+struct FCreditsBinaryStyle
+{
+	int32 FontAsset;
+	int32 FontMaterialAsset;
+	int32 FontSize;
+	FLinearColor Color;
+	float Padding[4];
+	uint32 ImageSizeOverride;
+	float ImageSize[2];
+};
+
+/** Simple struct for a closing credits image as stored in a binary file. */
+struct FCreditsBinaryImage
+{
+	int32 Asset;
+	float NativeSize[2];
+	uint32 bSoft;
+};
+
+/**
+ * Compact, versioned binary form of compiled closing credits.
+ * The file is the line table columns, the style table, the image table and the asset path table, each stored as a
+ * raw chunk, so reading it back is a memory map and a bounds check per chunk, with no parsing at all.
+ */
+class CREDITS_API FCreditsBinary
+{
+public:
+
+	/** Writes Credits to Filename. */
+	static bool Save(const FCreditsCompiledCredits& Credits, const FString& Filename);
+
+	/** Writes Credits to OutData. */
+	static void Write(const FCreditsCompiledCredits& Credits, TArray<uint8>& OutData);
+};
+
+/**
+ * Closing credits binary file mapped in memory.
+ * Every column is a view into the mapped file and every line text a view into its string pool, so opening the
+ * file allocates nothing per line. Platforms without memory mapping read the file into a single buffer instead.
+ * The views are read in place; rolling the credits takes a copy of them as FCreditsCompiledCredits, one allocation
+ * and one bulk copy per column, which the rollers and the painter read from.
+ */
+class CREDITS_API FCreditsMappedCredits
+{
+public:
+
+	FCreditsMappedCredits();
+	~FCreditsMappedCredits();
+
+	UE_NONCOPYABLE(FCreditsMappedCredits);
+
+	/** Maps Filename, validating its header and chunks. */
+	bool Open(const FString& Filename);
+
+	/** Unmaps the file, every view becomes invalid. */
+	void Close();
+
+	/** Returns whether a file is mapped. */
+	bool IsOpen() const
+	{
+		return Header != nullptr;
+	}
+
+	/** Returns the number of lines. */
+	int32 Num() const
+	{
+		return Kinds.Num();
+	}
+
+	/** Returns the text of Line as a view into the mapped string pool. */
+	FORCEINLINE FStringView GetText(int32 Line) const
+	{
+		return FStringView(StringPool.GetData() + TextStarts[Line], TextLengths[Line]);
+	}
+
+	/** Returns the asset path at AssetIndex as a view into the mapped asset pool. */
+	FStringView GetAssetPath(int32 AssetIndex) const;
+
+	/** Returns the height of the whole credits. */
+	float GetTotalHeight() const;
+
+	/**
+	 * Requests the fonts, font materials and hard images of the file from the streamable manager in one batch, so
+	 * ToCompiledCredits finds them loaded.
+	 * @param	OnLoaded	Fires once every asset is loaded, at once when there is nothing to load
+	 * @return	The handle keeping the assets loaded, null when there is nothing to load
+	 */
+	TSharedPtr<FStreamableHandle> RequestAssets(FStreamableDelegate OnLoaded = FStreamableDelegate()) const;
+
+	/**
+	 * Copies the mapped file into Out, one bulk copy per column, resolving the fonts, font materials and hard images.
+	 * Those not requested by RequestAssets beforehand are loaded through the streamable manager in one blocking batch.
+	 * Game thread only, as it loads assets.
+	 */
+	bool ToCompiledCredits(FCreditsCompiledCredits& Out) const;
+
+	/** Returns the size of the mapped file. */
+	int64 GetMappedSize() const;
+
+	/** reference to the text of every line, packed back to back. */
+	TConstArrayView<TCHAR> StringPool;
+
+	/** reference to where each line text starts in the string pool. */
+	TConstArrayView<int32> TextStarts;
+
+	/** reference to the length of each line text. */
+	TConstArrayView<int32> TextLengths;
+
+	/** reference to the interned style of each line. */
+	TConstArrayView<uint16> StyleIndices;
+
+	/** reference to the image of each line, INDEX_NONE for text lines. */
+	TConstArrayView<int32> ImageIndices;
+
+	/** reference to the top of each line. */
+	TConstArrayView<float> OffsetsY;
+
+	/** reference to the content width of each line. */
+	TConstArrayView<float> Widths;
+
+	/** reference to the height of each line. */
+	TConstArrayView<float> Heights;
+
+	/** reference to the kind of each line. */
+	TConstArrayView<ECreditsLineKind> Kinds;
+
+	/** reference to the ECreditsLineFlags of each line. */
+	TConstArrayView<uint8> Flags;
+
+	/** reference to the first line of each section. */
+	TConstArrayView<int32> SectionStarts;
+
+	/** reference to the padding above each section. */
+	TConstArrayView<float> SectionPaddingTop;
+
+	/** reference to the padding below each section. */
+	TConstArrayView<float> SectionPaddingBottom;
+
+	/** reference to the styles. */
+	TConstArrayView<FCreditsBinaryStyle> Styles;
+
+	/** reference to the images. */
+	TConstArrayView<FCreditsBinaryImage> Images;
+
+private:
+
+	/** Adds the paths of the fonts, font materials and hard images of the file to OutPaths, each once. */
+	void GetAssetsToLoad(TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** Points the views at the chunks of Data, returning false when a chunk is out of bounds or of the wrong size. */
+	bool MapViews(const uint8* Data, int64 Size);
+
+	/** reference to the mapped file. */
+	IMappedFileHandle* MappedFile;
+
+	/** reference to the mapped region, the whole file. */
+	IMappedFileRegion* MappedRegion;
+
+	/** reference to the file contents when the platform cannot map files. */
+	TArray<uint8> FallbackData;
+
+	/** reference to the header, at the start of the mapped data. */
+	const FCreditsBinaryHeader* Header;
+
+	/** reference to where each asset path starts in the asset pool. */
+	TConstArrayView<int32> AssetStarts;
+
+	/** reference to the length of each asset path. */
+	TConstArrayView<int32> AssetLengths;
+
+	/** reference to the asset paths, packed back to back. */
+	TConstArrayView<TCHAR> AssetPool;
+};
@@ -10,6 +10,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Classes/FCreditsProperties.h" // @todo still WIP while we refactor and get c++ properties using unreal macros.
 #include "CreditsManager.h"
+#include "CreditsOverrideIndex.h"
 #include "CreditsBlueprintLibrary.generated.h"
 
 /*
@@ -53,7 +54,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 */
 	// Checked
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsGeneralSettings(FCreditsGeneralSettings GeneralSettings, UCurveFloat*& SpeedCurve, UCurveFloat*& OpacityCurve, UCurveFloat*& VolumeCurve, ECreditsStartingPosition& CreditsStartingPosition, bool& TimeDilationEffectsCredits, bool& AutoPlayMusic, bool& RestartMusicAtEnd, bool& EndCreditsOnEndReached, bool& StopMusicOnCreditsEnded, bool& StopQueueingMusicWhenCreditsEnded);
+	static void BreakCreditsGeneralSettings(const FCreditsGeneralSettings& GeneralSettings, UCurveFloat*& SpeedCurve, UCurveFloat*& OpacityCurve, UCurveFloat*& VolumeCurve, ECreditsStartingPosition& CreditsStartingPosition, bool& TimeDilationEffectsCredits, bool& AutoPlayMusic, bool& RestartMusicAtEnd, bool& EndCreditsOnEndReached, bool& StopMusicOnCreditsEnded, bool& StopQueueingMusicWhenCreditsEnded);
 
 	/**
 	 * Make Credits General Settings.
@@ -78,22 +79,24 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @param	Image
 	 * @param	ImageSizeOverride
 	 * @param	ImageSizeProperties
+	 * @param	SoftImage
 	 * @return	FCreditsImageProperties
 	 */
 	// Checked
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsImageProperties(FCreditsImageProperties ImageProperties, UTexture2D*& Image, bool& ImageSizeOverride, FVector2D& ImageSizeProperties);
+	static void BreakCreditsImageProperties(const FCreditsImageProperties& ImageProperties, UTexture2D*& Image, bool& ImageSizeOverride, FVector2D& ImageSizeProperties, TSoftObjectPtr<UTexture2D>& SoftImage);
 
 	/**
 	 * Make Credits Image Properties.
 	 * @param	Image
 	 * @param	ImageSizeOverride
 	 * @param	ImageSizeProperties
+	 * @param	SoftImage
 	 * @return	FCreditsImageProperties
 	 */
 	// Checked
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Image = "", ImageSizeOverride = false, ImageSizeProperties = (5.0f, 4.0f), Keywords = "construct build", NativeMakeFunc))
-	static FCreditsImageProperties MakeCreditsImageProperties(UTexture2D* Image, bool ImageSizeOverride, FVector2D ImageSizeProperties);
+	static FCreditsImageProperties MakeCreditsImageProperties(UTexture2D* Image, bool ImageSizeOverride, const FVector2D& ImageSizeProperties, const TSoftObjectPtr<UTexture2D>& SoftImage);
 
 	/**
 	 * Break Credits Music.
@@ -105,7 +108,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 */
 	// Checked
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsMusic(FCreditsMusic CreditsMusic, USoundWave*& Audio, ECreditsSoundQueueMode& QueueMode, float& StartTime, float& PlayDelay);
+	static void BreakCreditsMusic(const FCreditsMusic& CreditsMusic, USoundWave*& Audio, ECreditsSoundQueueMode& QueueMode, float& StartTime, float& PlayDelay);
 
 	/**
 	 * Make Credits Music.
@@ -128,7 +131,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsNameOverrides
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsNameOverrides(FCreditsNameOverrides CreditsNameOverrides, FName& ParentSection, FName& ParentRole, FName& NameToOverride, FCreditsNameTextObject& OverrideData);
+	static void BreakCreditsNameOverrides(const FCreditsNameOverrides& CreditsNameOverrides, FName& ParentSection, FName& ParentRole, FName& NameToOverride, FCreditsNameTextObject& OverrideData);
 
 	/**
 	 * Make Credits Name Overrides.
@@ -139,7 +142,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsNameOverrides
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsNameOverrides MakeCreditsNameOverrides(FName ParentSection, FName ParentRole, FName NameToOverride, FCreditsNameTextObject OverrideData);
+	static FCreditsNameOverrides MakeCreditsNameOverrides(FName ParentSection, FName ParentRole, FName NameToOverride, const FCreditsNameTextObject& OverrideData);
 
 	/**
 	 * Break Credits Name Text Object.
@@ -149,7 +152,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsNameTextObject
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsNameTextObject(FCreditsNameTextObject CreditsNameTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding);
+	static void BreakCreditsNameTextObject(const FCreditsNameTextObject& CreditsNameTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding);
 
 	/**
 	 * Make Credits Name Text Object.
@@ -159,7 +162,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsNameTextObject
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsNameTextObject MakeCreditsNameTextObject(FCreditsTextProperties TextProperties, FCreditsImageProperties ImageProperties, FCreditsPaddingMargin Padding);
+	static FCreditsNameTextObject MakeCreditsNameTextObject(const FCreditsTextProperties& TextProperties, const FCreditsImageProperties& ImageProperties, const FCreditsPaddingMargin& Padding);
 
 	/**
 	 * Break Credits Overrides.
@@ -170,7 +173,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsOverrides
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsOverrides(FCreditsOverrides Overrides, FCreditsSectionOverride& SectionOverride, bool& IsOverridingSection, TArray<FCreditsRoleOverride>& RoleOverrides, TArray<FCreditsNameOverrides>& NameOverrides);
+	static void BreakCreditsOverrides(const FCreditsOverrides& Overrides, FCreditsSectionOverride& SectionOverride, bool& IsOverridingSection, TArray<FCreditsRoleOverride>& RoleOverrides, TArray<FCreditsNameOverrides>& NameOverrides);
 
 	/**
 	 * Make Credits Overrides.
@@ -181,7 +184,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsOverrides
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsOverrides MakeCreditsOverrides(FCreditsSectionOverride SectionOverride, bool IsOverridingSection, TArray<FCreditsRoleOverride> RoleOverrides, TArray<FCreditsNameOverrides> NameOverrides);
+	static FCreditsOverrides MakeCreditsOverrides(const FCreditsSectionOverride& SectionOverride, bool IsOverridingSection, const TArray<FCreditsRoleOverride>& RoleOverrides, const TArray<FCreditsNameOverrides>& NameOverrides);
 
 	/**
 	 * Break Credits Padding Margin.
@@ -192,7 +195,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsPaddingMargin
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsPaddingMargin(FCreditsPaddingMargin Padding, float& Left, float& Top, float& Right, float& Bottom);
+	static void BreakCreditsPaddingMargin(const FCreditsPaddingMargin& Padding, float& Left, float& Top, float& Right, float& Bottom);
 
 	/**
 	 * Make Credits Padding Margin.
@@ -212,7 +215,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRole
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsRole(FCreditsRole CreditsRole, FCreditsRoleDefaults& RoleProperties, TArray<FCreditsNameTextObject>& PlayedByNames);
+	static void BreakCreditsRole(const FCreditsRole& CreditsRole, FCreditsRoleDefaults& RoleProperties, TArray<FCreditsNameTextObject>& PlayedByNames);
 
 	/**
 	 * Make Credits Role.
@@ -221,7 +224,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRole
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsRole MakeCreditsRole(FCreditsRoleDefaults RoleProperties, TArray<FCreditsNameTextObject> PlayedByNames);
+	static FCreditsRole MakeCreditsRole(const FCreditsRoleDefaults& RoleProperties, const TArray<FCreditsNameTextObject>& PlayedByNames);
 
 	/**
 	 * Break Credits Role Defaults.
@@ -231,7 +234,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleDefaults
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsRoleDefaults(FCreditsRoleDefaults RoleDefaults, FCreditsTextObject& Role, ECreditsTextPosition& RolePosition, bool& DisplayRoleName);
+	static void BreakCreditsRoleDefaults(const FCreditsRoleDefaults& RoleDefaults, FCreditsTextObject& Role, ECreditsTextPosition& RolePosition, bool& DisplayRoleName);
 
 	/**
 	 * Make Credits Role Defaults.
@@ -241,7 +244,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleDefaults
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsRoleDefaults MakeCreditsRoleDefaults(FCreditsTextObject Role, ECreditsTextPosition RolePosition, bool DisplayRoleName);
+	static FCreditsRoleDefaults MakeCreditsRoleDefaults(const FCreditsTextObject& Role, ECreditsTextPosition RolePosition, bool DisplayRoleName);
 
 	/**
 	 * Break Credits Role Override.
@@ -251,7 +254,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleOverride
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsRoleOverride(FCreditsRoleOverride CreditsRoleOverride, FName& ParentSection, FName& RoleToOverride, FCreditsRoleDefaults& OverrideData);
+	static void BreakCreditsRoleOverride(const FCreditsRoleOverride& CreditsRoleOverride, FName& ParentSection, FName& RoleToOverride, FCreditsRoleDefaults& OverrideData);
 
 	/**
 	 * Make Credits Role Override.
@@ -261,7 +264,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleOverride
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsRoleOverride MakeCreditsRoleOverride(FName ParentSection, FName RoleToOverride, FCreditsRoleDefaults OverrideData);
+	static FCreditsRoleOverride MakeCreditsRoleOverride(FName ParentSection, FName RoleToOverride, const FCreditsRoleDefaults& OverrideData);
 
 	/**
 	 * Break Credits Role Struct Simple.
@@ -271,7 +274,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleStructSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsRoleStructSimple(FCreditsRoleStructSimple CreditsRoleStructSimple, FCreditsTextObjectSimple& Role, bool& DisplayRoleName, TArray<FCreditsTextObjectSimple>& PlayedBy);
+	static void BreakCreditsRoleStructSimple(const FCreditsRoleStructSimple& CreditsRoleStructSimple, FCreditsTextObjectSimple& Role, bool& DisplayRoleName, TArray<FCreditsTextObjectSimple>& PlayedBy);
 
 	/**
 	 * Make Credits Role Struct Simple.
@@ -281,7 +284,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsRoleStructSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsRoleStructSimple MakeCreditsRoleStructSimple(FCreditsTextObjectSimple Role, bool DisplayRoleName, TArray<FCreditsTextObjectSimple> PlayedBy);
+	static FCreditsRoleStructSimple MakeCreditsRoleStructSimple(const FCreditsTextObjectSimple& Role, bool DisplayRoleName, const TArray<FCreditsTextObjectSimple>& PlayedBy);
 
 	/**
 	 * Break Credits Section.
@@ -290,7 +293,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSection
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsSection(FCreditsSection CreditsSection, FCreditsSectionDefaults& SectionProperties, TArray<FCreditsRole>& Roles);
+	static void BreakCreditsSection(const FCreditsSection& CreditsSection, FCreditsSectionDefaults& SectionProperties, TArray<FCreditsRole>& Roles);
 
 	/**
 	 * Make Credits Section.
@@ -299,7 +302,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSection
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsSection MakeCreditsSection(FCreditsSectionDefaults SectionProperties, TArray<FCreditsRole> Roles);
+	static FCreditsSection MakeCreditsSection(const FCreditsSectionDefaults& SectionProperties, const TArray<FCreditsRole>& Roles);
 
 	/**
 	 * Break Credits Section Defaults.
@@ -309,7 +312,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionDefaults
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsSectionDefaults(FCreditsSectionDefaults CreditsSectionDefaults, FCreditsTextObject& Title, ECreditsStartingPosition& TitlePosition, FCreditsPaddingMargin& SectionPadding);
+	static void BreakCreditsSectionDefaults(const FCreditsSectionDefaults& CreditsSectionDefaults, FCreditsTextObject& Title, ECreditsStartingPosition& TitlePosition, FCreditsPaddingMargin& SectionPadding);
 
 	/**
 	 * Make Credits Section Defaults.
@@ -319,7 +322,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionDefaults
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsSectionDefaults MakeCreditsSectionDefaults(FCreditsTextObject Title, ECreditsStartingPosition TitlePosition, FCreditsPaddingMargin SectionPadding);
+	static FCreditsSectionDefaults MakeCreditsSectionDefaults(const FCreditsTextObject& Title, ECreditsStartingPosition TitlePosition, const FCreditsPaddingMargin& SectionPadding);
 
 	/**
 	 * Break Credits Section Override.
@@ -327,7 +330,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionOverride
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsSectionOverride(FCreditsSectionOverride CreditsSectionOverride, FCreditsSectionDefaults& OverrideData);
+	static void BreakCreditsSectionOverride(const FCreditsSectionOverride& CreditsSectionOverride, FCreditsSectionDefaults& OverrideData);
 
 	/**
 	 * Make Credits Section Override.
@@ -335,7 +338,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionOverride
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsSectionOverride MakeCreditsSectionOverride(FCreditsSectionDefaults OverrideData);
+	static FCreditsSectionOverride MakeCreditsSectionOverride(const FCreditsSectionDefaults& OverrideData);
 
 	/**
 	 * Break Credits Section Simple.
@@ -344,7 +347,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsSectionSimple(FCreditsSectionSimple CreditsSectionSimple, FCreditsTextObjectSimple& Title, TArray<FCreditsRoleStructSimple>& Roles);
+	static void BreakCreditsSectionSimple(const FCreditsSectionSimple& CreditsSectionSimple, FCreditsTextObjectSimple& Title, TArray<FCreditsRoleStructSimple>& Roles);
 
 	/**
 	 * Make Credits Section Simple.
@@ -353,7 +356,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsSectionSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsSectionSimple MakeCreditsSectionSimple(FCreditsTextObjectSimple Title, TArray<FCreditsRoleStructSimple> Roles);
+	static FCreditsSectionSimple MakeCreditsSectionSimple(const FCreditsTextObjectSimple& Title, const TArray<FCreditsRoleStructSimple>& Roles);
 
 	/**
 	 * Break Credits Text Object.
@@ -363,7 +366,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsTextObject
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsTextObject(FCreditsTextObject CreditsTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding);
+	static void BreakCreditsTextObject(const FCreditsTextObject& CreditsTextObject, FCreditsTextProperties& TextProperties, FCreditsImageProperties& ImageProperties, FCreditsPaddingMargin& Padding);
 
 	/**
 	 * Make Credits Text Object.
@@ -373,7 +376,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsTextObject
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsTextObject MakeCreditsTextObject(FCreditsTextProperties TextProperties, FCreditsImageProperties ImageProperties, FCreditsPaddingMargin Padding);
+	static FCreditsTextObject MakeCreditsTextObject(const FCreditsTextProperties& TextProperties, const FCreditsImageProperties& ImageProperties, const FCreditsPaddingMargin& Padding);
 
 	/**
 	 * Break Credits Text Object Simple.
@@ -382,7 +385,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsTextObjectSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsTextObjectSimple(FCreditsTextObjectSimple CreditsTextObjectSimple, FString& Text, FCreditsImageProperties& ImageProperties);
+	static void BreakCreditsTextObjectSimple(const FCreditsTextObjectSimple& CreditsTextObjectSimple, FString& Text, FCreditsImageProperties& ImageProperties);
 
 	/**
 	 * Make Credits Text Object Simple.
@@ -391,7 +394,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsTextObjectSimple
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (Keywords = "construct build", NativeMakeFunc))
-	static FCreditsTextObjectSimple MakeCreditsTextObjectSimple(FString Text, FCreditsImageProperties ImageProperties);
+	static FCreditsTextObjectSimple MakeCreditsTextObjectSimple(const FString& Text, const FCreditsImageProperties& ImageProperties);
 
 	/**
 	 * Break Credits Text Properties.
@@ -403,7 +406,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return	FCreditsTextProperties
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (NativeBreakFunc))
-	static void BreakCreditsTextProperties(FCreditsTextProperties Properties, FString& Title, UFont*& Font, UMaterialInterface*& FontMaterial, int& FontSize, FLinearColor& Color);
+	static void BreakCreditsTextProperties(const FCreditsTextProperties& Properties, FString& Title, UFont*& Font, UMaterialInterface*& FontMaterial, int& FontSize, FLinearColor& Color);
 
 	/**
 	 * Make Credits Text Properties.
@@ -415,7 +418,7 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @return FCreditsTextProperties
 	 */
 	UFUNCTION(BlueprintPure, Category = "Credits|Utilities|Struct", meta = (FontSize = 24, Keywords = "construct build", NativeMakeFunc))
-	static FCreditsTextProperties MakeCreditsTextProperties(FString Title, UFont* Font, UMaterialInterface* FontMaterial, int FontSize, FLinearColor Color);
+	static FCreditsTextProperties MakeCreditsTextProperties(const FString& Title, UFont* Font, UMaterialInterface* FontMaterial, int FontSize, const FLinearColor& Color);
 
 	/////////////////////////////
 	// End Break/Make Function.
@@ -433,35 +436,35 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	 * @param	ActorsToRecord	The actors to record
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Simple Roles to Complex Roles", Keywords = "Simple Roles to Complex Roles"), Category = "Default")
-	static void SimpleRolesToComplexRoles(TArray<FCreditsRoleStructSimple> SimpleRole, TArray<FCreditsRoleOverride> RoleOverrides, TArray<FCreditsNameOverrides> NameOverrides, UObject* WorldContextObject, TArray<FCreditsRole>& ComplexRole);
+	static void SimpleRolesToComplexRoles(const TArray<FCreditsRoleStructSimple>& SimpleRole, const TArray<FCreditsRoleOverride>& RoleOverrides, const TArray<FCreditsNameOverrides>& NameOverrides, UObject* WorldContextObject, TArray<FCreditsRole>& ComplexRole);
 
 	/**
 	 * Simple Text Object (Role) to Complex Text Object.
 	 * @param	ActorsToRecord	The actors to record
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Simple Text Object (Role) To Complex Text Object", Keywords = "Simple Text Object To Complex Text Object"), Category = "Default")
-	static void SimpleTextObjectRoleToComplexTextObject(FCreditsTextObjectSimple Simple, UObject* WorldContextObject, FCreditsTextObject& Complex);
+	static void SimpleTextObjectRoleToComplexTextObject(const FCreditsTextObjectSimple& Simple, UObject* WorldContextObject, FCreditsTextObject& Complex);
 
 	/**
 	 * Simple Played By Names to Complex Played By Names.
 	 * @param	ActorsToRecord	The actors to record
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Simple Played By Names to Complex Played By Names", Keywords = "Simple Played By Names to Complex Played By Names"), Category = "Default")
-	static void SimplePlayedByNamesToComplexPlayedByNames(TArray<FCreditsTextObjectSimple> Simple, TArray<FCreditsNameOverrides> Overrides, UObject* WorldContextObject, TArray<FCreditsNameTextObject>& Complex);
+	static void SimplePlayedByNamesToComplexPlayedByNames(const TArray<FCreditsTextObjectSimple>& Simple, const TArray<FCreditsNameOverrides>& Overrides, UObject* WorldContextObject, TArray<FCreditsNameTextObject>& Complex);
 
 	/**
 	 * Simple Credits Section to Complex Credits Section.
 	 * @param	ActorsToRecord	The actors to record
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Simple Credits Section to Complex Credits Section", Keywords = "Simple Credits Section to Complex Credits Section"), Category = "Default")
-	static void SimpleCreditsSectionToComplexCreditsSection(FCreditsSectionSimple Simple, FCreditsOverrides Overrides, UObject* WorldContextObject, FCreditsSection& Complex);
+	static void SimpleCreditsSectionToComplexCreditsSection(const FCreditsSectionSimple& Simple, const FCreditsOverrides& Overrides, UObject* WorldContextObject, FCreditsSection& Complex);
 
 	/**
 	 * Simple Text Object (Title) to Complex Text Object.
 	 * @param	ActorsToRecord	The actors to record
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Simple Text Object (Title) to Complex Text Object", Keywords = "Simple Text Object (Title) to Complex Text Object"), Category = "Default")
-	static void SimpleTextObjectTitleToComplexTextObject(FCreditsTextObjectSimple Simple, UObject* WorldContextObject, FCreditsTextObject& Complex);
+	static void SimpleTextObjectTitleToComplexTextObject(const FCreditsTextObjectSimple& Simple, UObject* WorldContextObject, FCreditsTextObject& Complex);
 
 	/**
 	 * Get Overriden Roles.
@@ -471,11 +474,14 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	static void GetOverridenRoles(FName Section, UObject* WorldContextObject, TArray<FCreditsRoleOverride>& OverridenRoles);
 
 	/**
-	 * Get Override Data for Role.
-	 * @param	ActorsToRecord	The actors to record
+	 * Get Override Data for Role, the override for the role in Section, falling back to an override without a parent
+	 * section, as Find Role Override in Index does. Build an index once to look up many roles.
+	 * @param	RoleName		The role to look up
+	 * @param	OverridenRoles	The role overrides
+	 * @param	Section			The parent section of the role, None to only match overrides without one
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Get Override Data for Role", Keywords = "Get Override Data for Role"), Category = "Default")
-	static void GetOverrideDataForRole(const FString RoleName, TArray<FCreditsRoleOverride> OverridenRoles, UObject* WorldContextObject, FCreditsRoleDefaults& Data, bool& IsOverriding);
+	static void GetOverrideDataForRole(const FString& RoleName, const TArray<FCreditsRoleOverride>& OverridenRoles, UObject* WorldContextObject, FCreditsRoleDefaults& Data, bool& IsOverriding, FName Section = NAME_None);
 
 	/**
 	 * Get Overriden Names.
@@ -492,9 +498,54 @@ class /*CREDITS_API*/ UCreditsBlueprintLibrary : public UBlueprintFunctionLibrar
 	static void GetRolesInSection(FName Section, UObject* WorldContextObject, TArray<FCreditsRoleStructSimple>& Roles);
 
 	/**
-	 * Get Override Data for Name.
-	 * @param	ActorsToRecord	The actors to record
+	 * Get Override Data for Name, the most specific override for the name in Section and Role, falling back as
+	 * Find Name Override in Index does. Build an index once to look up many names.
+	 * @param	Name			The name to look up
+	 * @param	OverridenNames	The name overrides
+	 * @param	Section			The parent section of the name, None to only match overrides without one
+	 * @param	Role			The parent role of the name, None to only match overrides without one
 	 */
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "Get Override Data for Name", Keywords = "Get Override Data for Name"), Category = "Default")
-	static void GetOverrideDataForName(const FString Name, TArray<FCreditsNameOverrides> OverridenNames, UObject* WorldContextObject, FCreditsNameOverrides& Data, bool& IsOverriding);
+	static void GetOverrideDataForName(const FString& Name, const TArray<FCreditsNameOverrides>& OverridenNames, UObject* WorldContextObject, FCreditsNameOverrides& Data, bool& IsOverriding, FName Section = NAME_None, FName Role = NAME_None);
+
+	/////////////////////////////
+	// Override Index.
+	/////////////////////////////
+
+	/**
+	 * Build Credits Override Index, resolving every override once so later lookups are constant time.
+	 * @param	SectionOverrides	DataTable of FCreditsSectionOverride rows, keyed on the section name
+	 * @param	RoleOverrides		DataTable of FCreditsRoleOverride rows
+	 * @param	NameOverrides		DataTable of FCreditsNameOverrides rows
+	 * @return	FCreditsOverrideIndexHandle
+	 */
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "Build Credits Override Index", Keywords = "Build Credits Override Index"), Category = "Credits|Overrides")
+	static FCreditsOverrideIndexHandle BuildCreditsOverrideIndex(const UDataTable* SectionOverrides, const UDataTable* RoleOverrides, const UDataTable* NameOverrides);
+
+	/**
+	 * Find Section Override in Index.
+	 * @param	Index	The prebuilt override index
+	 * @param	Section	The section to look up
+	 */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Find Section Override in Index", Keywords = "Find Section Override in Index"), Category = "Credits|Overrides")
+	static void FindSectionOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FCreditsSectionDefaults& Data, bool& IsOverriding);
+
+	/**
+	 * Find Role Override in Index.
+	 * @param	Index	The prebuilt override index
+	 * @param	Section	The parent section of the role
+	 * @param	Role	The role to look up
+	 */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Find Role Override in Index", Keywords = "Find Role Override in Index"), Category = "Credits|Overrides")
+	static void FindRoleOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FName Role, FCreditsRoleDefaults& Data, bool& IsOverriding);
+
+	/**
+	 * Find Name Override in Index.
+	 * @param	Index	The prebuilt override index
+	 * @param	Section	The parent section of the name
+	 * @param	Role	The parent role of the name
+	 * @param	Name	The name to look up
+	 */
+	UFUNCTION(BlueprintPure, meta = (DisplayName = "Find Name Override in Index", Keywords = "Find Name Override in Index"), Category = "Credits|Overrides")
+	static void FindNameOverrideInIndex(const FCreditsOverrideIndexHandle& Index, FName Section, FName Role, FName Name, FCreditsNameTextObject& Data, bool& IsOverriding);
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CreditsManager.h"
+
+/**
+ * Native closing credits builder.
+ * Appends sections, roles and names in place and takes ownership of moved arguments, so nothing is copied
+ * on the way in. Given the counts up front, every array of the resulting credits is allocated once.
+ *
+ *	FCreditsBuilder Builder;
+ *	Builder.Reserve(1)
+ *		.AddSection(MoveTemp(SectionProperties), 1)
+ *		.AddRole(MoveTemp(RoleProperties), Names.Num());
+ *	for (FString& Name : Names)
+ *	{
+ *		Builder.AddName(MoveTemp(Name));
+ *	}
+ *	TArray<FCreditsSection> Sections = Builder.Build();
+ */
+class CREDITS_API FCreditsBuilder
+{
+public:
+
+	FCreditsBuilder();
+
+	/** Reserves space for NumSections sections. */
+	FCreditsBuilder& Reserve(int32 NumSections);
+
+	/** Opens a new section, with space reserved for NumRoles roles. */
+	FCreditsBuilder& AddSection(const FCreditsSectionDefaults& SectionProperties, int32 NumRoles = 0);
+	FCreditsBuilder& AddSection(FCreditsSectionDefaults&& SectionProperties, int32 NumRoles = 0);
+
+	/** Appends a complete section, later roles are added to it. */
+	FCreditsBuilder& AddSection(FCreditsSection&& Section);
+
+	/** Opens a new role in the current section, with space reserved for NumNames names. */
+	FCreditsBuilder& AddRole(const FCreditsRoleDefaults& RoleProperties, int32 NumNames = 0);
+	FCreditsBuilder& AddRole(FCreditsRoleDefaults&& RoleProperties, int32 NumNames = 0);
+
+	/** Appends a complete role to the current section, later names are added to it. */
+	FCreditsBuilder& AddRole(FCreditsRole&& Role);
+
+	/** Appends a name to the current role. */
+	FCreditsBuilder& AddName(const FCreditsNameTextObject& Name);
+	FCreditsBuilder& AddName(FCreditsNameTextObject&& Name);
+
+	/** Appends a name with the default name style to the current role. */
+	FCreditsBuilder& AddName(const FString& Text);
+	FCreditsBuilder& AddName(FString&& Text);
+
+	/** Returns the sections built so far. */
+	const TArray<FCreditsSection>& GetSections() const
+	{
+		return Sections;
+	}
+
+	/** Moves the built sections out, leaving the builder empty. */
+	TArray<FCreditsSection> Build();
+
+private:
+
+	/** Returns the role names are currently added to. */
+	TArray<FCreditsNameTextObject>& GetCurrentNames();
+
+	/** reference to the sections being built. */
+	TArray<FCreditsSection> Sections;
+
+	/** reference to the default name style, copied for names added as plain text. */
+	FCreditsNameTextObject DefaultName;
+};
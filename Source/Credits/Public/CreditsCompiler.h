@@ -0,0 +1,114 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "CreditsManager.h"
+#include "CreditsLineTable.h"
+#include "CreditsStyleTable.h"
+#include "Styling/SlateBrush.h"
+
+class UDataTable;
+
+/**
+ * Closing credits compiled into their runtime form: the line table plus the styles and images it references.
+ * Holds the referenced assets alive for as long as it exists, soft images only while they are streamed in.
+ */
+class CREDITS_API FCreditsCompiledCredits : public FGCObject
+{
+public:
+
+	FCreditsCompiledCredits() = default;
+
+	/** Constructs credits the collector only sees once RegisterGCObject is called, for credits filled off the game thread. */
+	explicit FCreditsCompiledCredits(EFlags Flags)
+		: FGCObject(Flags)
+	{}
+
+	/** Removes every line, style and image. */
+	void Reset();
+
+	/**
+	 * Returns where the content of Line sits in credits space for a view ViewWidth wide,
+	 * with side roles and their names split into two columns and the style padding applied.
+	 */
+	void GetLineContentRect(int32 Line, float ViewWidth, FVector2D& OutPosition, FVector2D& OutSize) const;
+
+	/** Appends an image of NativeSize to the image table and returns its index, Texture may be null for a soft image not loaded yet. */
+	int32 AddImage(const FSoftObjectPath& Path, UTexture2D* Texture, const FVector2D& NativeSize, bool bSoft);
+
+	/** Sets the texture of the image at ImageIndex, its brush drawing nothing while Texture is null. */
+	void SetImage(int32 ImageIndex, UTexture2D* Texture);
+
+	/**
+	 * Removes the styles and images no line shows any more, after sections were replaced or freed.
+	 * @param	OutImageRemap	The new index of each image, INDEX_NONE for a removed one, empty when no image moved
+	 * @return	Whether anything was removed, the style and image indices of every line changing with it
+	 */
+	bool CompactTables(TArray<int32>& OutImageRemap);
+
+	/** Returns the memory allocated by the compiled credits. */
+	SIZE_T GetAllocatedSize() const;
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+	/** reference to the flattened lines. */
+	FCreditsLineTable Lines;
+
+	/** reference to the interned styles, indexed by FCreditsLineTable::StyleIndices. */
+	FCreditsStyleTable Styles;
+
+	/** reference to the images, indexed by FCreditsLineTable::ImageIndices, null while a soft image is not streamed in. */
+	TArray<UTexture2D*> Images;
+
+	/** reference to the Slate brush of each image, drawing nothing while the image is not streamed in. */
+	TArray<FSlateBrush> ImageBrushes;
+
+	/** reference to the path of each image. */
+	TArray<FSoftObjectPath> ImagePaths;
+
+	/** reference to whether each image is soft referenced by the credits, and so streamed in and out. */
+	TArray<bool> SoftImages;
+
+	/** reference to the index of each image in Images. */
+	TMap<FSoftObjectPath, int32> ImageLookup;
+
+	/** reference to the atlas pages some image brushes draw from, see FCreditsImageAtlas. */
+	TArray<UTexture*> AtlasPages;
+};
+
+/**
+ * Flattens the nested FCreditsSection -> FCreditsRole -> FCreditsNameTextObject tree into FCreditsCompiledCredits.
+ */
+class CREDITS_API FCreditsCompiler
+{
+public:
+
+	/**
+	 * Adds every image the rows of Table show to the image table of Out, with its size, so compiling them later never
+	 * looks at an object. Soft images are added unloaded, even those loaded already. Game thread only.
+	 */
+	static void AddTableImages(const UDataTable* Table, FCreditsCompiledCredits& Out);
+
+	/** Compiles Sections into Out, replacing its previous content. */
+	static void Compile(const TArray<FCreditsSection>& Sections, FCreditsCompiledCredits& Out);
+
+	/** Appends the lines of Section to Out, the caller updates the offsets once every section is in. */
+	static void CompileSection(const FCreditsSection& Section, FCreditsCompiledCredits& Out);
+
+	/** Returns an estimate of the height of a text line, used until the lines are measured. */
+	static float EstimateTextHeight(const FCreditsLineStyle& Style);
+
+	/** Returns an estimate of the width of a text line of NumChars characters, used until the lines are measured. */
+	static float EstimateTextWidth(const FCreditsLineStyle& Style, int32 NumChars);
+
+	/** Returns the width of an image line. */
+	static float GetImageWidth(const FCreditsLineStyle& Style, const FVector2D& NativeSize);
+
+	/** Returns the height of an image line. */
+	static float GetImageHeight(const FCreditsLineStyle& Style, const FVector2D& NativeSize);
+};
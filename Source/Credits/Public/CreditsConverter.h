@@ -0,0 +1,45 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "CreditsManager.h"
+
+class FCreditsOverrideIndex;
+class UDataTable;
+
+/**
+ * Converts the simple credits structs into their complex counterparts.
+ * Sections, roles and names are converted on worker threads straight into preallocated output arrays,
+ * every output element being written by exactly one task, so the result does not depend on scheduling.
+ *
+ * Simple text objects only carry a text and an image, the rest comes from the struct defaults or, when an
+ * override matches, from the override. Overrides are looked up by the section key, the role text and the name text,
+ * through a FCreditsStyleResolver, so the names of a role without overridden names are never looked up.
+ */
+class CREDITS_API FCreditsConverter
+{
+public:
+
+	/** Converts a simple title into a complex text object with the section title defaults. */
+	static void ConvertTitle(const FCreditsTextObjectSimple& Simple, FCreditsTextObject& Out);
+
+	/** Converts a simple role into a complex text object with the role defaults. */
+	static void ConvertRoleText(const FCreditsTextObjectSimple& Simple, FCreditsTextObject& Out);
+
+	/** Converts the simple names of Role in Section, applying the matching name overrides. */
+	static void ConvertNames(const TArray<FCreditsTextObjectSimple>& Simple, const FCreditsOverrideIndex* Overrides, const FName& Section, const FName& Role, TArray<FCreditsNameTextObject>& Out, EParallelForFlags Flags = EParallelForFlags::None);
+
+	/** Converts the simple roles of Section, applying the matching role and name overrides. */
+	static void ConvertRoles(const TArray<FCreditsRoleStructSimple>& Simple, const FCreditsOverrideIndex* Overrides, const FName& Section, TArray<FCreditsRole>& Out, EParallelForFlags Flags = EParallelForFlags::None);
+
+	/** Converts a simple section known as SectionKey to the overrides. */
+	static void ConvertSection(const FCreditsSectionSimple& Simple, const FCreditsOverrideIndex* Overrides, const FName& SectionKey, FCreditsSection& Out, EParallelForFlags Flags = EParallelForFlags::None);
+
+	/** Converts simple sections, each known to the overrides by its title. */
+	static void ConvertSections(const TArray<FCreditsSectionSimple>& Simple, const FCreditsOverrideIndex* Overrides, TArray<FCreditsSection>& Out, EParallelForFlags Flags = EParallelForFlags::None);
+
+	/** Converts a DataTable of FCreditsSectionSimple rows in row order, each known to the overrides by its row name. */
+	static void ConvertDataTable(const UDataTable* Sections, const FCreditsOverrideIndex* Overrides, TArray<FCreditsSection>& Out, EParallelForFlags Flags = EParallelForFlags::None);
+};
@@ -0,0 +1,140 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+class UCurveFloat;
+struct FCreditsGeneralSettings;
+
+/**
+ * Closing credits curve baked into a fixed-step lookup table.
+ * Evaluating is two reads and a lerp whatever the keys of the source curve, and the running integral of the samples
+ * gives, for the speed curve, the scroll position at any time without summing up frames, so it does not depend on
+ * the frame rate. The curve is sampled from 0, or its first key when earlier, to its last key. Outside of them it
+ * follows the pre and post extrapolation of the curve, values falling back to FRichCurve::Eval and integrals to
+ * the held, linear or cycled area of the samples; before the first sample, which a roll never reaches, the integral
+ * only follows a linear extrapolation.
+ */
+class CREDITS_API FCreditsCurveTable
+{
+public:
+
+	/** Seconds between two samples, unless the curve is too long to bake at that step. */
+	static const float DefaultStepSeconds;
+
+	/** Most samples a curve is baked into, longer curves are baked at a coarser step. */
+	static const int32 MaxSamples = 65536;
+
+	FCreditsCurveTable();
+
+	/**
+	 * Bakes Curve, or a constant DefaultValue when it is null.
+	 * @param	Curve			The curve to bake, may be null
+	 * @param	DefaultValue	The value when there is no curve
+	 * @param	StepSeconds		The seconds between two samples
+	 */
+	void Bake(const UCurveFloat* Curve, float DefaultValue, float StepSeconds = DefaultStepSeconds);
+
+	/** Returns the value of the curve at Time. */
+	FORCEINLINE float Evaluate(float Time) const
+	{
+		const float Position = (Time - StartTime) * InvStepSeconds;
+		if (Position <= 0.0f)
+		{
+			return bEvalPreExtrapolation ? SourceCurve.Eval(Time) : Values[0];
+		}
+		const int32 Index = (int32)Position;
+		if (Index >= Values.Num() - 1)
+		{
+			return bEvalPostExtrapolation ? SourceCurve.Eval(Time) : Values.Last();
+		}
+		return FMath::Lerp(Values[Index], Values[Index + 1], Position - Index);
+	}
+
+	/** Returns the integral of the curve from 0 to Time, for the speed curve the distance scrolled. */
+	float EvaluateIntegral(float Time) const;
+
+	/**
+	 * Returns the time at which the integral of the curve reaches Integral, for the speed curve when the credits
+	 * scrolled that far, with a binary search over the running integral, bisecting the extrapolated area past the
+	 * last sample. The curve should not go negative.
+	 */
+	float FindTimeAtIntegral(float Integral) const;
+
+	/** Returns the time of the last baked sample, the curve extrapolates after it. */
+	float GetEndTime() const
+	{
+		return StartTime + (Values.Num() - 1) * StepSeconds;
+	}
+
+	/** Returns the memory allocated by the table. */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Values.GetAllocatedSize() + Integrals.GetAllocatedSize();
+	}
+
+private:
+
+	/** Returns the integral of the samples from the first one to Time, clamped to the baked range. */
+	double IntegrateSamples(double Time) const;
+
+	/** Returns the integral of the post extrapolation from the last sample to Delta seconds after it. */
+	double IntegratePostExtrapolation(double Delta) const;
+
+	/** reference to the value of each sample. */
+	TArray<float> Values;
+
+	/** reference to the integral from 0 to each sample. */
+	TArray<double> Integrals;
+
+	/** reference to the seconds between two samples. */
+	float StepSeconds;
+
+	/** reference to the samples per second. */
+	float InvStepSeconds;
+
+	/** reference to the time of the first sample, 0 unless the curve has earlier keys. */
+	float StartTime;
+
+	/** reference to the time of the first key, where a cycle of the post extrapolation starts. */
+	float CycleStartTime;
+
+	/** reference to the integral from the first sample to 0. */
+	double ZeroIntegral;
+
+	/** reference to the slope of a linear pre extrapolation. */
+	float PreSlope;
+
+	/** reference to the slope of a linear post extrapolation. */
+	float PostSlope;
+
+	/** reference to the post extrapolation of the curve. */
+	TEnumAsByte<ERichCurveExtrapolation> PostExtrapolation;
+
+	/** reference to whether values before the first sample are evaluated on the source curve. */
+	bool bEvalPreExtrapolation;
+
+	/** reference to whether values after the last sample are evaluated on the source curve. */
+	bool bEvalPostExtrapolation;
+
+	/** reference to the source curve, only kept when it extrapolates other than by holding its ends. */
+	FRichCurve SourceCurve;
+};
+
+/** Simple struct for the baked speed, opacity and volume curves of a closing credits roll. */
+struct CREDITS_API FCreditsRollCurves
+{
+	/** Bakes the curves of Settings, the speed falling back to DefaultSpeed, the opacity and volume to 1. */
+	void Bake(const FCreditsGeneralSettings& Settings, float DefaultSpeed);
+
+	/** reference to the speed, in credits-space units per second. */
+	FCreditsCurveTable Speed;
+
+	/** reference to the opacity. */
+	FCreditsCurveTable Opacity;
+
+	/** reference to the music volume. */
+	FCreditsCurveTable Volume;
+};
@@ -0,0 +1,61 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class UCurveFloat;
+class UFont;
+class UMaterialInterface;
+class USoundWave;
+class UTexture2D;
+
+/**
+ * Default assets shared by every closing credits struct.
+ * Resolved once per module lifetime (after engine init, or on first use from the game thread)
+ * so constructing credits structs never goes through the object lookup path. Whatever the first resolve
+ * finds is kept, and structs built off the game thread before the defaults are resolved get null defaults.
+ */
+struct CREDITS_API FCreditsDefaultAssets
+{
+	/** reference to the default font. */
+	UFont* Font = nullptr;
+
+	/** reference to the default font material. */
+	UMaterialInterface* FontMaterial = nullptr;
+
+	/** reference to the default image. */
+	UTexture2D* Texture2D = nullptr;
+
+	/** reference to the default music wave file. */
+	USoundWave* SoundWave = nullptr;
+
+	/** reference to the default credits speed curve. */
+	UCurveFloat* SpeedCurve = nullptr;
+
+	/** reference to the default credits opacity curve. */
+	UCurveFloat* OpacityCurve = nullptr;
+
+	/** reference to the default credits volume curve. */
+	UCurveFloat* VolumeCurve = nullptr;
+
+	/** Returns the shared default assets, resolving them on first use from the game thread. */
+	static FORCEINLINE const FCreditsDefaultAssets& Get()
+	{
+		return bResolved.load(std::memory_order_acquire) ? Instance : ResolveOnFirstUse();
+	}
+
+	/** Loads the default assets and keeps them alive until Release is called. Game thread only. */
+	static void Resolve();
+
+	/** Drops the references taken by Resolve. Called when the module shuts down. */
+	static void Release();
+
+private:
+
+	static const FCreditsDefaultAssets& ResolveOnFirstUse();
+
+	static FCreditsDefaultAssets Instance;
+	static std::atomic<bool> bResolved;
+};
@@ -0,0 +1,40 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FCreditsCompiledCredits;
+
+/** Simple struct for what a closing credits glyph prewarm did. */
+struct CREDITS_API FCreditsGlyphPrewarmStats
+{
+	/** reference to the number of unique font, size and font material combinations. */
+	int32 NumFonts = 0;
+
+	/** reference to the number of glyphs rasterized, summed over the fonts. */
+	int32 NumGlyphs = 0;
+
+	/** reference to the number of font atlas pages the glyphs took. */
+	int32 NumNewAtlasPages = 0;
+};
+
+/**
+ * Closing credits glyph cache prewarm.
+ * Rasterizes every character of the credits text, in every font, size and font material it is shown with,
+ * into the Slate font cache ahead of the roll, so no glyph is rasterized while the credits scroll.
+ */
+class CREDITS_API FCreditsGlyphPrewarm
+{
+public:
+
+	/**
+	 * Rasterizes the glyphs used by Credits into the font cache. Game thread only.
+	 * Glyphs are cached per scale, so FontScale should be the scale the roller is drawn at.
+	 * @return	Whether the glyphs were rasterized, false without a Slate renderer
+	 */
+	static bool Prewarm(const FCreditsCompiledCredits& Credits, float FontScale = 1.0f, FCreditsGlyphPrewarmStats* OutStats = nullptr);
+
+	/** Rasterizes the glyphs used by the lines of Credits from FirstLine up to EndLine only, see Prewarm. */
+	static bool PrewarmLines(const FCreditsCompiledCredits& Credits, int32 FirstLine, int32 EndLine, float FontScale = 1.0f, FCreditsGlyphPrewarmStats* OutStats = nullptr);
+};
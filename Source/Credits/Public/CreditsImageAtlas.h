@@ -0,0 +1,107 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CreditsImageAtlas.generated.h"
+
+class FCreditsCompiledCredits;
+class UTexture2D;
+
+/** Simple struct for where a closing credits image sits in an atlas page. */
+USTRUCT(BlueprintType)
+struct CREDITS_API FCreditsAtlasEntry
+{
+	GENERATED_BODY()
+
+	FCreditsAtlasEntry();
+
+	/** reference to the index of the page in the atlas. */
+	UPROPERTY(VisibleAnywhere, Category = Credits)
+	int32 Page;
+
+	/** reference to the top left UV of the image in the page. */
+	UPROPERTY(VisibleAnywhere, Category = Credits)
+	FVector2D UVMin;
+
+	/** reference to the bottom right UV of the image in the page. */
+	UPROPERTY(VisibleAnywhere, Category = Credits)
+	FVector2D UVMax;
+};
+
+/**
+ * Closing credits image atlas built at cook time.
+ * The source images are packed into texture pages in the editor, so at runtime the atlased images of the
+ * credits only have to be pointed at their page, and soft images among them are never streamed.
+ */
+UCLASS(BlueprintType)
+class CREDITS_API UCreditsImageAtlasAsset : public UDataAsset
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** The images to pack, each at most Max Image Size on both sides. */
+	UPROPERTY(EditAnywhere, Category = "Credits", meta = (DisplayName = "Source Images"))
+	TArray<TSoftObjectPtr<UTexture2D>> SourceImages;
+
+	/** The width and height of each page. */
+	UPROPERTY(EditAnywhere, Category = "Credits", meta = (ClampMin = "64", DisplayName = "Page Size"))
+	int32 PageSize;
+
+	/** The largest image packed, larger ones are left out of the atlas. */
+	UPROPERTY(EditAnywhere, Category = "Credits", meta = (ClampMin = "1", DisplayName = "Max Image Size"))
+	int32 MaxImageSize;
+
+	/** reference to the packed pages. */
+	UPROPERTY(VisibleAnywhere, Category = "Credits")
+	TArray<UTexture2D*> Pages;
+
+	/** reference to the entry of each packed image. */
+	UPROPERTY(VisibleAnywhere, Category = "Credits")
+	TMap<FSoftObjectPath, FCreditsAtlasEntry> Entries;
+
+#if WITH_EDITOR
+	/** Packs the source images into new pages. Only images with BGRA8 source data are packed. */
+	UFUNCTION(CallInEditor, Category = "Credits")
+	void BuildAtlas();
+
+	//~ Begin UObject Interface
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	//~ End UObject Interface
+#endif
+};
+
+/**
+ * Packs the small images of compiled credits into shared atlas pages.
+ * Every atlased brush draws its page through a UV region, so a wall of logos is a single texture and the
+ * Slate batcher draws it as one batch. Images are placed on shelves, tallest first.
+ */
+class CREDITS_API FCreditsImageAtlas
+{
+public:
+
+	/**
+	 * Renders the resident images of Credits at most MaxImageSize on both sides into render target pages.
+	 * Soft images are left to the asset streamer. Game thread only.
+	 * @return	The number of images moved to an atlas page
+	 */
+	static int32 Build(FCreditsCompiledCredits& Credits, int32 PageSize = 2048, int32 MaxImageSize = 256);
+
+	/**
+	 * Points the images of Credits found in Atlas at their cooked page.
+	 * @return	The number of images moved to an atlas page
+	 */
+	static int32 Apply(FCreditsCompiledCredits& Credits, const UCreditsImageAtlasAsset* Atlas);
+
+	/** Pixels left between packed images, so bilinear filtering never samples a neighbour. */
+	static const int32 Padding = 2;
+
+	/**
+	 * Places images of Sizes on shelves of PageSize square pages, tallest first.
+	 * Images that do not fit a page get INDEX_NONE as their page.
+	 * @return	The number of pages used
+	 */
+	static int32 Pack(const TArray<FIntPoint>& Sizes, int32 PageSize, TArray<int32>& OutPages, TArray<FIntPoint>& OutPositions);
+};
@@ -0,0 +1,86 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CreditsManager.h"
+
+class UDataTable;
+
+/** Simple enum for closing credits import source format. */
+enum class ECreditsImportFormat : uint8
+{
+	Csv,
+	Json
+};
+
+/** Simple struct for one flat record of a closing credits export, a name of a role of a section. */
+struct CREDITS_API FCreditsImportRecord
+{
+	/** reference to the section title. */
+	FString Section;
+
+	/** reference to the role, empty for a record describing the section title. */
+	FString Role;
+
+	/** reference to the name, empty for a record describing the section title or the role. */
+	FString Name;
+
+	/** reference to the image path of whatever the record describes. */
+	FString Image;
+};
+
+/** Simple struct for closing credits import counts and timings. */
+struct CREDITS_API FCreditsImportStats
+{
+	int32 NumRecords = 0;
+	int32 NumRows = 0;
+	int32 NumAdded = 0;
+	int32 NumChanged = 0;
+	int32 NumUnchanged = 0;
+	int32 NumRemoved = 0;
+
+	/** whether the row order changed so the table was rebuilt in order. */
+	bool bRebuilt = false;
+
+	double ParseSeconds = 0.0;
+	double BuildSeconds = 0.0;
+	double DiffSeconds = 0.0;
+	double ApplySeconds = 0.0;
+};
+
+/**
+ * Imports closing credits exports into DataTables, touching only the rows that changed.
+ *
+ * Sections tables (FCreditsSectionSimple rows) are imported from flat Section,Role,Name,Image records, CSV with a
+ * header row or a JSON array of objects with the same keys. The text is split into chunks that are parsed on worker
+ * threads, the records are grouped into one row per section, in first seen order, and every row is built and hashed
+ * on worker threads. Rows are matched to the table by row name, the section title, and only rows whose content hash
+ * differs are written. Any other table, the override tables, is imported through the DataTable CSV/JSON format into
+ * a staging table and diffed the same way.
+ */
+class CREDITS_API FCreditsImporter
+{
+public:
+
+	/** Imports Filename, CSV or JSON by extension, into Table. Rows missing from the file are removed when bRemoveMissingRows. */
+	static bool ImportFile(UDataTable* Table, const FString& Filename, bool bRemoveMissingRows = true, FCreditsImportStats* OutStats = nullptr);
+
+	/** Imports flat section records from Text into a FCreditsSectionSimple Table. */
+	static bool ImportSections(UDataTable* Table, const FString& Text, ECreditsImportFormat Format, bool bRemoveMissingRows = true, FCreditsImportStats* OutStats = nullptr);
+
+	/** Imports DataTable formatted rows from Text into Table, whatever its row struct. */
+	static bool ImportRows(UDataTable* Table, const FString& Text, ECreditsImportFormat Format, bool bRemoveMissingRows = true, FCreditsImportStats* OutStats = nullptr);
+
+	/** Parses flat records from Text, chunk by chunk on worker threads. */
+	static void ParseRecords(const FString& Text, ECreditsImportFormat Format, TArray<FCreditsImportRecord>& OutRecords);
+
+	/** Groups Records into one section per title, in first seen order, hashing each. */
+	static void BuildSections(const TArray<FCreditsImportRecord>& Records, TArray<FName>& OutRowNames, TArray<FCreditsSectionSimple>& OutSections, TArray<uint64>& OutHashes);
+
+	/** Returns the content hash of Section, equal for sections with the same texts, images and flags. */
+	static uint64 GetSectionHash(const FCreditsSectionSimple& Section);
+
+	/** Number of characters parsed by one worker task. */
+	static const int32 ChunkSize = 256 * 1024;
+};
@@ -0,0 +1,147 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "CreditsOverrideIndex.h"
+
+class FCreditsCompiledCredits;
+class UDataTable;
+
+/**
+ * Keeps closing credits compiled from DataTables up to date as the tables change.
+ * Every section remembers the content hash of its row and the roles and names it holds. When any of the tables
+ * changes, only the sections whose row changed, or that an added, removed or edited override applies to, are
+ * converted, compiled and laid out again, and spliced back in place, the lines below only shifting by the change
+ * in height. Only the rows the table names as changed are hashed again and patched into the override index; the
+ * styles and images no line uses anymore are then dropped. Added, removed or reordered rows, and tables of complex
+ * FCreditsSection rows, are compiled again whole.
+ */
+class CREDITS_API FCreditsIncrementalCompiler : public FGCObject, public TSharedFromThis<FCreditsIncrementalCompiler>
+{
+public:
+
+	FCreditsIncrementalCompiler(UDataTable* InSections, UDataTable* InSectionOverrides, UDataTable* InRoleOverrides, UDataTable* InNameOverrides);
+	virtual ~FCreditsIncrementalCompiler();
+
+	/** Compiles every section and starts following the tables, once the compiler is owned by a shared pointer. */
+	void Start();
+
+	/**
+	 * Recompiles the sections whose row or overrides changed since the last compile.
+	 * @return	The first line that changed, INDEX_NONE when nothing did
+	 */
+	int32 Update();
+
+	/** Returns the compiled credits, updated in place. */
+	TSharedRef<FCreditsCompiledCredits> GetCompiledCredits() const
+	{
+		return Compiled;
+	}
+
+	/**
+	 * Fires after an update changed lines, with the first line that changed, whether everything was compiled again
+	 * and the new index of each image when unused ones were dropped, empty when no image moved.
+	 */
+	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnRecompiled, int32, bool, const TArray<int32>&);
+	FOnRecompiled OnRecompiled;
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+private:
+
+	/** Simple struct for what a compiled section depends on. */
+	struct FSectionState
+	{
+		/** reference to the row name of the section, its key to the overrides. */
+		FName Key;
+
+		/** reference to the content hash of the row. */
+		uint64 Hash = 0;
+
+		/** reference to the role of each role of the section. */
+		TArray<FName> RoleKeys;
+
+		/** reference to the name of each name of the section. */
+		TArray<FName> NameKeys;
+	};
+
+	/** Compiles and lays out every section, recording what each depends on. */
+	void CompileAll();
+
+	/** Records the keys of the rows of the override tables, to patch the override index from the rows that change. */
+	void GatherOverrideRows();
+
+	/**
+	 * Brings the override index up to date with the changed tables, patching it from the changed rows when the tables
+	 * named them, and marks the sections an override of a changed key applies to.
+	 */
+	void UpdateOverrides(const TSet<const UDataTable*>& Tables, const TMap<const UDataTable*, TSet<FName>>& RowNames, TArray<bool>& Dirty);
+
+	/** Compiles and lays out the section at SectionIndex again and splices it in place. */
+	void RecompileSection(int32 SectionIndex, const uint8* Row);
+
+	/** Fills State with the hash and the keys of Row. */
+	static void GatherSection(const uint8* Row, FSectionState& State);
+
+	/** Marks the sections an override of the changed keys applies to. */
+	void MarkOverriddenSections(const TArray<FName>& SectionKeys, const TArray<FCreditsOverrideKey>& RoleKeys, const TArray<FCreditsOverrideKey>& NameKeys, TArray<bool>& Dirty) const;
+
+	/** Called whenever Table changes. */
+	void HandleTableChanged(UDataTable* Table);
+
+	/** Called whenever a row of a credits table changes, before its table does. */
+	void HandleRowChanged(const UDataTable* Table, FName RowName);
+
+	/** reference to the sections table. */
+	UDataTable* Sections;
+
+	/** reference to the section overrides table, may be null. */
+	UDataTable* SectionOverrides;
+
+	/** reference to the role overrides table, may be null. */
+	UDataTable* RoleOverrides;
+
+	/** reference to the name overrides table, may be null. */
+	UDataTable* NameOverrides;
+
+	/** reference to the compiled credits. */
+	TSharedRef<FCreditsCompiledCredits> Compiled;
+
+	/** reference to the overrides the credits were compiled with. */
+	TSharedRef<FCreditsOverrideIndex> Overrides;
+
+	/** reference to the state of each compiled section, in row order. */
+	TArray<FSectionState> SectionStates;
+
+	/** reference to the index of each section, keyed on its row name. */
+	TMap<FName, int32> SectionIndices;
+
+	/** reference to the override key of each row of the section overrides table. */
+	TMap<FName, FCreditsOverrideKey> SectionOverrideRows;
+
+	/** reference to the override key of each row of the role overrides table. */
+	TMap<FName, FCreditsOverrideKey> RoleOverrideRows;
+
+	/** reference to the override key of each row of the name overrides table. */
+	TMap<FName, FCreditsOverrideKey> NameOverrideRows;
+
+	/** reference to the tables changed since the last update. */
+	TSet<const UDataTable*> ChangedTables;
+
+	/** reference to the rows each table named as changed since the last update. */
+	TMap<const UDataTable*, TSet<FName>> ChangedRowNames;
+
+	/** reference to the change bindings of each table. */
+	TArray<TPair<UDataTable*, FDelegateHandle>> TableHandles;
+
+	/** reference to the binding of the row changes. */
+	FDelegateHandle RowChangedHandle;
+
+	/** reference to whether the sections table holds simple rows, the only ones compiled incrementally. */
+	bool bSimpleRows;
+};
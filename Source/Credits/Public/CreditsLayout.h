@@ -0,0 +1,25 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FCreditsCompiledCredits;
+
+/**
+ * Headless closing credits layout.
+ * Measures the text lines of compiled credits with the Slate font measure service, without any widget,
+ * so the position of every line and the total height are known before the first frame.
+ */
+class CREDITS_API FCreditsLayout
+{
+public:
+
+	/**
+	 * Measures the text lines of Credits and lays every line out.
+	 * The glyphs used by each style are measured once on the game thread, the lines are then summed up on worker threads.
+	 * Without a Slate renderer, or off the game thread, the compiler estimates are kept and only the offsets are updated.
+	 * @return	Whether the text lines were measured
+	 */
+	static bool Layout(FCreditsCompiledCredits& Credits);
+};
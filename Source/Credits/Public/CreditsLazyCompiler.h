@@ -0,0 +1,113 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "CreditsManager.h"
+
+class FCreditsCompiledCredits;
+class FCreditsOverrideIndex;
+class UDataTable;
+
+/** Simple struct for closing credits lazy update, what one update of the lazy compiler changed. */
+struct CREDITS_API FCreditsLazyUpdate
+{
+	/** reference to the first line that changed, INDEX_NONE when nothing did. */
+	int32 FirstLine = INDEX_NONE;
+
+	/** reference to the sections the update materialized. */
+	TArray<int32> MaterializedSections;
+
+	/** reference to the new index of each image, INDEX_NONE for a removed one, empty when no image moved. */
+	TArray<int32> ImageRemap;
+};
+
+/**
+ * Compiles closing credits one section at a time as they scroll by.
+ * The sections are kept in their simple form, and each stands in the compiled credits as an empty placeholder
+ * section of its estimated height until it comes within the window around the viewport. It is then converted,
+ * compiled and laid out, and spliced in place of its placeholder, and once it leaves the window again its lines
+ * are swapped back for a placeholder of its exact height, and the styles and images no line shows any more are
+ * dropped, so only the sections around the viewport hold lines, styles and images.
+ * The change between the estimated and exact height of a section moves the lines below it, so a section
+ * materialized wholly above the anchor, the scroll offset, moves the anchor by the same amount and the lines
+ * shown stay in place. Sections skipped over by a seek keep their estimate until they are materialized.
+ */
+class CREDITS_API FCreditsLazyCompiler : public FGCObject
+{
+public:
+
+	/**
+	 * Compiles Sections, each looking its overrides up by its key in SectionKeys, the row name of a DataTable section
+	 * as FCreditsConverter::ConvertDataTable does.
+	 */
+	FCreditsLazyCompiler(const TArray<FCreditsSectionSimple>& InSections, const TArray<FName>& InSectionKeys, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides);
+
+	/** Compiles the FCreditsSectionSimple rows of SectionsTable, keyed by their row names. */
+	FCreditsLazyCompiler(const UDataTable* SectionsTable, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides);
+
+	/** Lays every section out as a placeholder of its estimated height. */
+	void Start();
+
+	/**
+	 * Materializes the sections reaching into the window from Top to Bottom and frees the others.
+	 * @param	Anchor	The credits-space Y the window hangs from, moved with the lines under it
+	 * @param	Top		The top of the window
+	 * @param	Bottom	The bottom of the window
+	 * @return	What the update changed
+	 */
+	FCreditsLazyUpdate Update(float& Anchor, float Top, float Bottom);
+
+	/** Returns the compiled credits, updated in place. */
+	TSharedRef<FCreditsCompiledCredits> GetCompiledCredits() const
+	{
+		return Compiled;
+	}
+
+	/** Returns whether the section at SectionIndex holds its lines. */
+	bool IsMaterialized(int32 SectionIndex) const
+	{
+		return bMaterialized[SectionIndex];
+	}
+
+	/** Returns how many sections hold their lines. */
+	int32 GetNumMaterialized() const
+	{
+		return NumMaterialized;
+	}
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+private:
+
+	/** Converts, compiles and lays out the section at SectionIndex, splicing it in place of its placeholder. */
+	void MaterializeSection(int32 SectionIndex);
+
+	/** Swaps the lines of the section at SectionIndex for a placeholder of the same height. */
+	void FreeSection(int32 SectionIndex);
+
+	/** reference to the simple sections. */
+	TArray<FCreditsSectionSimple> Sections;
+
+	/** reference to the key of each section to the overrides. */
+	TArray<FName> SectionKeys;
+
+	/** reference to the title of each section, the name it is sought by. */
+	TArray<FName> SectionTitles;
+
+	/** reference to whether each section holds its lines. */
+	TArray<bool> bMaterialized;
+
+	/** reference to the compiled credits. */
+	TSharedRef<FCreditsCompiledCredits> Compiled;
+
+	/** reference to the overrides the sections are converted with. */
+	TSharedRef<FCreditsOverrideIndex> Overrides;
+
+	/** reference to how many sections hold their lines. */
+	int32 NumMaterialized;
+};
@@ -0,0 +1,152 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "CreditsManager.h"
+#include "CreditsLineTable.generated.h"
+
+/** Simple enum for closing credits line kind. */
+UENUM(BlueprintType)
+enum class ECreditsLineKind : uint8
+{
+	SectionTitle UMETA( DisplayName = "Section Title", ToolTip = "Line Kind - Section Title" ),
+	Role UMETA( DisplayName = "Role", ToolTip = "Line Kind - Role" ),
+	Name UMETA( DisplayName = "Name", ToolTip = "Line Kind - Name" ),
+	Image UMETA( DisplayName = "Image", ToolTip = "Line Kind - Image" ),
+};
+
+/** Simple flags for how a closing credits line is placed. */
+namespace ECreditsLineFlags
+{
+	enum Type : uint8
+	{
+		None = 0,
+		/** the line is a role drawn beside its names, it does not advance the layout. */
+		SideColumn = 1 << 0,
+		/** the line is a name drawn in the column next to a side role. */
+		NameColumn = 1 << 1,
+	};
+}
+
+/**
+ * Flattened closing credits, stored as a structure of arrays.
+ * Every line is an index into the parallel arrays, so walking the visible range touches contiguous memory only.
+ */
+struct CREDITS_API FCreditsLineTable
+{
+	/** Returns the number of lines. */
+	FORCEINLINE int32 Num() const
+	{
+		return Kinds.Num();
+	}
+
+	/** Returns the text of Line as a view into the string pool. */
+	FORCEINLINE FStringView GetText(int32 Line) const
+	{
+		return FStringView(*StringPool + TextStarts[Line], TextLengths[Line]);
+	}
+
+	/** Appends a line and returns its index, its offset is filled in by UpdateOffsets. */
+	int32 AddLine(ECreditsLineKind Kind, FStringView Text, uint16 StyleIndex, int32 ImageIndex, float Width, float Height, uint8 LineFlags);
+
+	/** Opens a new section, lines added afterwards belong to it. */
+	void BeginSection(const FCreditsPaddingMargin& SectionPadding);
+
+	/**
+	 * Lays the lines out top to bottom as a prefix sum of their heights, filling OffsetsY, SectionOffsetsY and
+	 * TotalHeight, and names every section after its title line. A side role and its names share a row as tall as
+	 * the taller of the two columns, the image of the role taking a row of its own above it.
+	 */
+	void UpdateOffsets();
+
+	/**
+	 * Replaces the lines of Section with the lines of Source, a table holding that one section only, laying them out
+	 * in place and shifting the lines and sections below by the change in height. Source text is appended to the
+	 * string pool, which is compacted once most of it is text of replaced lines.
+	 */
+	void ReplaceSection(int32 Section, const FCreditsLineTable& Source);
+
+	/** Rewrites the string pool with the text of the current lines only. */
+	void CompactStringPool();
+
+	/** Returns the first line of Section and the line after its last one. */
+	FORCEINLINE void GetSectionRange(int32 Section, int32& OutFirst, int32& OutEnd) const
+	{
+		OutFirst = SectionStarts[Section];
+		OutEnd = Section + 1 < SectionStarts.Num() ? SectionStarts[Section + 1] : Num();
+	}
+
+	/** Returns the index of the section titled Name, or INDEX_NONE. */
+	int32 FindSection(const FName& Name) const;
+
+	/** Returns the section holding Line. */
+	int32 FindSectionOfLine(int32 Line) const;
+
+	/**
+	 * Finds the lines overlapping [Top, Bottom) with a binary search over OffsetsY, OutEnd is exclusive. A side line
+	 * reaching into the range pulls in the names of its row above it, which may lie wholly above Top.
+	 */
+	void FindLineRange(float Top, float Bottom, int32& OutFirst, int32& OutEnd) const;
+
+	/** Reserves space for NumLines lines holding NumChars characters of text. */
+	void Reserve(int32 NumLines, int32 NumChars);
+
+	/** Removes every line and section. */
+	void Reset();
+
+	/** Returns the memory allocated by the table. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** reference to the text of every line, packed back to back. */
+	FString StringPool;
+
+	/** reference to where each line text starts in the string pool. */
+	TArray<int32> TextStarts;
+
+	/** reference to the length of each line text. */
+	TArray<int32> TextLengths;
+
+	/** reference to the interned style of each line, see FCreditsStyleTable. */
+	TArray<uint16> StyleIndices;
+
+	/** reference to the image of each line, INDEX_NONE for text lines. */
+	TArray<int32> ImageIndices;
+
+	/** reference to the top of each line, relative to the top of the credits. */
+	TArray<float> OffsetsY;
+
+	/** reference to the content width of each line, padding excluded. */
+	TArray<float> Widths;
+
+	/** reference to the height of each line, padding included. */
+	TArray<float> Heights;
+
+	/** reference to the kind of each line. */
+	TArray<ECreditsLineKind> Kinds;
+
+	/** reference to the ECreditsLineFlags of each line. */
+	TArray<uint8> Flags;
+
+	/** reference to the first line of each section. */
+	TArray<int32> SectionStarts;
+
+	/** reference to the padding above each section. */
+	TArray<float> SectionPaddingTop;
+
+	/** reference to the padding below each section. */
+	TArray<float> SectionPaddingBottom;
+
+	/** reference to the top of each section, above its padding, relative to the top of the credits. */
+	TArray<float> SectionOffsetsY;
+
+	/** reference to the title of each section, NAME_None for sections without a title line. */
+	TArray<FName> SectionNames;
+
+	/** reference to the height of the whole credits. */
+	float TotalHeight = 0.0f;
+
+	/** reference to whether the text widths and heights were measured, rather than estimated. */
+	bool bMeasured = false;
+};
@@ -13,10 +13,19 @@
 #include "Math/Color.h"
 #include "Math/Vector2D.h"
 #include "Sound/SoundWave.h"
-#include "UObject/ConstructorHelpers.h"
 #include "UObject/NameTypes.h"
+#include "UObject/SoftObjectPtr.h"
+#include "CreditsDefaultAssets.h"
 #include "CreditsManager.generated.h"
 
+class FReferenceCollector;
+
+/** Delegate fired when a row of a closing credits DataTable changes, with its table and row name. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnCreditsRowChanged, const UDataTable* /*Table*/, FName /*RowName*/);
+
+/** Returns the delegate the section and override rows fire when the DataTable names them as changed. */
+CREDITS_API FOnCreditsRowChanged& OnCreditsRowChanged();
+
 /** Simple enum for closing credits starting position. */
 UENUM(BlueprintType)
 enum class ECreditsStartingPosition : uint8
@@ -55,15 +64,11 @@ struct CREDITS_API FCreditsTextProperties /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset properties.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsTextProperties()
 		: Title(FString())
-		, Font(DefaultFont)
-		, FontMaterial(DefaultFontMaterial)
+		, Font(FCreditsDefaultAssets::Get().Font)
+		, FontMaterial(FCreditsDefaultAssets::Get().FontMaterial)
 		, FontSize(24)
 		, Color(1.0f, 1.0f, 1.0f, 1.0f)
 		{}
@@ -71,6 +76,9 @@ struct CREDITS_API FCreditsTextProperties /*: public FCreditsManager*/
 	/** Simple constructor */
 	FCreditsTextProperties(const FString InTitle, UFont* InFont, UMaterialInterface* InFontMaterial, int InFontSize, const FLinearColor& InColor);
 
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
 	/** reference to the image name. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Text"))
 	FString Title;
@@ -98,23 +106,40 @@ struct CREDITS_API FCreditsImageProperties /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset properties.
-	UTexture2D* DefaultImage = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsImageProperties()
-		: Image(DefaultImage)
+		: Image(FCreditsDefaultAssets::Get().Texture2D)
+		, SoftImage()
 		, ImageSizeOverride(false)
 		, ImageSizeProperties(0.0f, 0.0f)
 	{}
 
 	/** Simple constructor */
-	FCreditsImageProperties(UTexture2D* InImage, bool InImageSizeOverride, FVector2D InImageSizeProperties);
+	FCreditsImageProperties(UTexture2D* InImage, bool InImageSizeOverride, FVector2D InImageSizeProperties, const TSoftObjectPtr<UTexture2D>& InSoftImage = TSoftObjectPtr<UTexture2D>());
+
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+	/** Returns true when a hard or a soft image is set. */
+	bool HasImage() const
+	{
+		return Image != nullptr || !SoftImage.IsNull();
+	}
+
+	/** Returns the path of the image, the hard image winning over the soft one. */
+	FSoftObjectPath GetImagePath() const
+	{
+		return Image != nullptr ? FSoftObjectPath(Image) : SoftImage.ToSoftObjectPath();
+	}
 
 	/** reference to the image. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Image"))
 	UTexture2D* Image;
 
+	/** reference to the image, streamed in only while it is about to scroll on screen. Used when Image is not set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Soft Image"))
+	TSoftObjectPtr<UTexture2D> SoftImage;
+
 	/** reference to the override size. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Image Size Override?"))
 	bool ImageSizeOverride;
@@ -165,21 +190,19 @@ struct CREDITS_API FCreditsTextObject /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset properties.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsTextObject()
-		: TextProperties(FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(1.0f, 1.0f, 1.0f, 1.0f)))
-		, ImageProperties(FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)))
+		: TextProperties(FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(1.0f, 1.0f, 1.0f, 1.0f)))
+		, ImageProperties(FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)))
 		, Padding(FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 0.0f))
 	{}
 
 	/** Simple constructor */
 	FCreditsTextObject(const FCreditsTextProperties& InTextProperties, const FCreditsImageProperties& InImageProperties, const FCreditsPaddingMargin& InPadding);
 
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
 	/** reference to the text properties. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Text Properties"))
 	FCreditsTextProperties TextProperties;
@@ -199,17 +222,12 @@ struct CREDITS_API FCreditsRoleDefaults /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsRoleDefaults()
 		: Role(
 			FCreditsTextObject(
-				FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
-				FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+				FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
+				FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 				FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 0.0f)
 			)
 		)
@@ -220,6 +238,9 @@ struct CREDITS_API FCreditsRoleDefaults /*: public FCreditsManager*/
 	/** Simple constructor */
 	FCreditsRoleDefaults(const FCreditsTextObject& InRole, const ECreditsTextPosition& InRolePosition, bool InDisplayRoleName);
 
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
 	/** reference to the role. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Role"))
 	FCreditsTextObject Role;
@@ -239,16 +260,11 @@ struct CREDITS_API FCreditsSectionDefaults /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsSectionDefaults()
 		: Title(
-			FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0)),
-			FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+			FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0)),
+			FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 			FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 15.0f)
 		)
 		, TitlePosition(ECreditsStartingPosition::Top)
@@ -258,6 +274,9 @@ struct CREDITS_API FCreditsSectionDefaults /*: public FCreditsManager*/
 	/** Simple constructor */
 	FCreditsSectionDefaults(const FCreditsTextObject& InTitle, const ECreditsStartingPosition& InTitlePosition, const FCreditsPaddingMargin& InSectionPadding);
 
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
 	/** reference to the credits text object. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Title"))
 	FCreditsTextObject Title;
@@ -279,16 +298,11 @@ struct CREDITS_API FCreditsGeneralSettings /*: public FCreditsManager*/
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default float curves asset locations.
-	UCurveFloat* SpeedCurveFloat = LoadObject<UCurveFloat>(NULL, TEXT("/Game/Base/Blueprints/FloatCurves/CreditsSpeedCurve.CreditsSpeedCurve"), NULL, LOAD_None, NULL);
-	UCurveFloat* OpacityCurveFloat = LoadObject<UCurveFloat>(NULL, TEXT("/Game/Base/Blueprints/FloatCurves/CreditsOpacityCurve.CreditsOpacityCurve"), NULL, LOAD_None, NULL);
-	UCurveFloat* VolumeCurveFloat = LoadObject<UCurveFloat>(NULL, TEXT("/Game/Base/Blueprints/FloatCurves/MusicVolumeCurve.MusicVolumeCurve"), NULL, LOAD_None, NULL);
-
 	/** default constructor */
 	FCreditsGeneralSettings()
-		: SpeedCurve(SpeedCurveFloat)
-		, OpacityCurve(OpacityCurveFloat)
-		, VolumeCurve(VolumeCurveFloat)
+		: SpeedCurve(FCreditsDefaultAssets::Get().SpeedCurve)
+		, OpacityCurve(FCreditsDefaultAssets::Get().OpacityCurve)
+		, VolumeCurve(FCreditsDefaultAssets::Get().VolumeCurve)
 		, CreditsStartingPosition(ECreditsStartingPosition::Top)
 		, TimeDilationEffectsCredits(true)
 		, AutoPlayMusic(true)
@@ -359,21 +373,19 @@ struct CREDITS_API FCreditsNameTextObject
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsNameTextObject()
-		: TextProperties(FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.9f, 0.9f, 0.9f, 1.0f)))
-		, ImageProperties(FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)))
+		: TextProperties(FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(0.9f, 0.9f, 0.9f, 1.0f)))
+		, ImageProperties(FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)))
 		, Padding(FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 10.0f))
 	{}
 
 	/** Simple constructor */
 	FCreditsNameTextObject(const FCreditsTextProperties& InTextProperties, const FCreditsImageProperties& InImageProperties, const FCreditsPaddingMargin& InPadding);
 
+	/** Reports the referenced assets to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
 	/** reference to the text properties. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Text Properties"))
 	FCreditsTextProperties TextProperties;
@@ -393,11 +405,9 @@ struct CREDITS_API FCreditsMusic : public FTableRowBase
 {
 	GENERATED_USTRUCT_BODY()
 
-	USoundWave* DefaultSoundWave = LoadObject<USoundWave>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsMusic()
-		: Audio(DefaultSoundWave)
+		: Audio(FCreditsDefaultAssets::Get().SoundWave)
 		, QueueMode(ECreditsSoundQueueMode::AfterPreviousAudio)
 		, StartTime(0.0f)
 		, PlayDelay(0.0f)
@@ -429,18 +439,13 @@ struct CREDITS_API FCreditsSectionOverride : public FTableRowBase
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsSectionOverride()
 		: OverrideData(
 			FCreditsSectionDefaults(
 				FCreditsTextObject(
-					FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
-					FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+					FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
+					FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 					FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 15.0f)
 				),
 				ECreditsStartingPosition(ECreditsStartingPosition::Top),
@@ -455,6 +460,10 @@ struct CREDITS_API FCreditsSectionOverride : public FTableRowBase
 	/** reference to the credits section defaults. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Override Data"))
 	FCreditsSectionDefaults OverrideData;
+
+	//~ Begin FTableRowBase Interface
+	virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override;
+	//~ End FTableRowBase Interface
 };
 
 /** Simple struct for closing credits role override. */
@@ -463,11 +472,6 @@ struct CREDITS_API FCreditsRoleOverride : public FTableRowBase
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsRoleOverride()
 		: ParentSection(FName(TEXT("None")))
@@ -475,8 +479,8 @@ struct CREDITS_API FCreditsRoleOverride : public FTableRowBase
 		, OverrideData(
 			FCreditsRoleDefaults(
 				FCreditsTextObject(
-					FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
-					FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+					FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
+					FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 					FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 0.0f)
 				),
 				ECreditsTextPosition(ECreditsTextPosition::Side),
@@ -499,6 +503,10 @@ struct CREDITS_API FCreditsRoleOverride : public FTableRowBase
 	/** the generic name of the sound that will be used to look up the audio. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Override Data"))
 	FCreditsRoleDefaults OverrideData;
+
+	//~ Begin FTableRowBase Interface
+	virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override;
+	//~ End FTableRowBase Interface
 };
 
 /** Simple struct for closing credits name overrides. */
@@ -507,11 +515,6 @@ struct CREDITS_API FCreditsNameOverrides : public FTableRowBase
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsNameOverrides()
 		: ParentSection(FName(TEXT("None")))
@@ -519,8 +522,8 @@ struct CREDITS_API FCreditsNameOverrides : public FTableRowBase
 		, NameToOverride(FName(TEXT("None")))
 		, OverrideData(
 			FCreditsNameTextObject(
-				FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.9f, 0.9f, 0.9f, 1.0f)),
-				FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+				FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(0.9f, 0.9f, 0.9f, 1.0f)),
+				FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 				FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 10.0f)
 			)
 		)
@@ -544,6 +547,10 @@ struct CREDITS_API FCreditsNameOverrides : public FTableRowBase
 	/** reference to the override data. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Override Data"))
 	FCreditsNameTextObject OverrideData;
+
+	//~ Begin FTableRowBase Interface
+	virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override;
+	//~ End FTableRowBase Interface
 };
 
 /** Simple struct for closing credits overrides. */
@@ -552,19 +559,14 @@ struct CREDITS_API FCreditsOverrides
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsOverrides()
 		: SectionOverride(
 			FCreditsSectionOverride(
 				FCreditsSectionDefaults(
 					FCreditsTextObject(
-						FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
-						FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+						FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
+						FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 						FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 15.0f)
 					),
 					ECreditsStartingPosition(ECreditsStartingPosition::Top),
@@ -578,7 +580,10 @@ struct CREDITS_API FCreditsOverrides
 	{}
 
 	/** Simple constructor */
-	FCreditsOverrides(const FCreditsSectionOverride& InSectionOverride, bool InOverridingSection, TArray<FCreditsRoleOverride>& InRoleOverrides, TArray<FCreditsNameOverrides>& InNameOverrides);
+	FCreditsOverrides(const FCreditsSectionOverride& InSectionOverride, bool InOverridingSection, const TArray<FCreditsRoleOverride>& InRoleOverrides, const TArray<FCreditsNameOverrides>& InNameOverrides);
+
+	/** Constructor taking ownership of the override arrays. */
+	FCreditsOverrides(FCreditsSectionOverride&& InSectionOverride, bool InOverridingSection, TArray<FCreditsRoleOverride>&& InRoleOverrides, TArray<FCreditsNameOverrides>&& InNameOverrides);
 
 	/** reference to the actual sound queue mode. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Section Override"))
@@ -603,18 +608,13 @@ struct CREDITS_API FCreditsRole
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsRole()
 		: RoleProperties(
 			FCreditsRoleDefaults(
 				FCreditsTextObject(
-					FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
-					FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+					FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 24, FLinearColor(0.1f, 0.8f, 0.5f, 1.0f)),
+					FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 					FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 0.0f)
 				),
 				ECreditsTextPosition(ECreditsTextPosition::Side),
@@ -627,6 +627,9 @@ struct CREDITS_API FCreditsRole
 	/** Simple constructor */
 	FCreditsRole(const FCreditsRoleDefaults& InRoleProperties, const TArray<FCreditsNameTextObject>& InPlayedByNames);
 
+	/** Constructor taking ownership of the names. */
+	FCreditsRole(FCreditsRoleDefaults&& InRoleProperties, TArray<FCreditsNameTextObject>&& InPlayedByNames);
+
 	/** reference to the role defaults. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Role Properties"))
 	FCreditsRoleDefaults RoleProperties;
@@ -642,13 +645,10 @@ struct CREDITS_API FCreditsTextObjectSimple
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsTextObjectSimple()
 		: Text(FString())
-		, ImageProperties(FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)))
+		, ImageProperties(FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)))
 	{}
 
 	/** Simple constructor */
@@ -669,15 +669,12 @@ struct CREDITS_API FCreditsRoleStructSimple
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsRoleStructSimple()
 		: Role(
 			FCreditsTextObjectSimple(
 				FString(),
-				FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f))
+				FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f))
 			)
 		)
 		, DisplayRoleName(false)
@@ -685,7 +682,10 @@ struct CREDITS_API FCreditsRoleStructSimple
 	{}
 
 	/** Simple constructor */
-	FCreditsRoleStructSimple(const FCreditsTextObjectSimple& InRole, bool InDisplayRoleName, TArray<FCreditsTextObjectSimple>& InPlayedBy);
+	FCreditsRoleStructSimple(const FCreditsTextObjectSimple& InRole, bool InDisplayRoleName, const TArray<FCreditsTextObjectSimple>& InPlayedBy);
+
+	/** Constructor taking ownership of the names. */
+	FCreditsRoleStructSimple(FCreditsTextObjectSimple&& InRole, bool InDisplayRoleName, TArray<FCreditsTextObjectSimple>&& InPlayedBy);
 
 	/** reference to the text object simple. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Role"))
@@ -706,17 +706,12 @@ struct CREDITS_API FCreditsSection
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UFont* DefaultFont = LoadObject<UFont>(NULL, TEXT("/Engine/EngineFonts/Roboto.Roboto"), NULL, LOAD_None, NULL);
-	UMaterialInterface* DefaultFontMaterial = LoadObject<UMaterialInterface>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsSection()
 		: SectionProperties(
 			FCreditsTextObject(
-				FCreditsTextProperties(FString(), DefaultFont, DefaultFontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
-				FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f)),
+				FCreditsTextProperties(FString(), FCreditsDefaultAssets::Get().Font, FCreditsDefaultAssets::Get().FontMaterial, 30, FLinearColor(0.9f, 0.4f, 0.06f, 1.0f)),
+				FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f)),
 				FCreditsPaddingMargin(0.0f, 0.0f, 0.0f, 15.0f)
 			),
 			ECreditsStartingPosition(ECreditsStartingPosition::Top),
@@ -728,6 +723,9 @@ struct CREDITS_API FCreditsSection
 	/** Simple constructor */
 	FCreditsSection(const FCreditsSectionDefaults& InSectionProperties, const TArray<FCreditsRole>& InRoles);
 
+	/** Constructor taking ownership of the roles. */
+	FCreditsSection(FCreditsSectionDefaults&& InSectionProperties, TArray<FCreditsRole>&& InRoles);
+
 	/** reference to the credits section defaults. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Section Properties"))
 	FCreditsSectionDefaults SectionProperties;
@@ -743,15 +741,12 @@ struct CREDITS_API FCreditsSectionSimple : public FTableRowBase
 {
 	GENERATED_USTRUCT_BODY()
 
-	// default asset locations.
-	UTexture2D* DefaultTexture2D = LoadObject<UTexture2D>(NULL, TEXT(""), NULL, LOAD_NoWarn, NULL);
-
 	/** default constructor */
 	FCreditsSectionSimple()
 		: Title(
 			FCreditsTextObjectSimple(
 				FString(),
-				FCreditsImageProperties(DefaultTexture2D, false, FVector2D(0.0f, 0.0f))
+				FCreditsImageProperties(FCreditsDefaultAssets::Get().Texture2D, false, FVector2D(0.0f, 0.0f))
 			)
 		)
 		, Roles()
@@ -760,6 +755,9 @@ struct CREDITS_API FCreditsSectionSimple : public FTableRowBase
 	/** Simple constructor */
 	FCreditsSectionSimple(const FCreditsTextObjectSimple& InTitle, const TArray<FCreditsRoleStructSimple>& InRoles);
 
+	/** Constructor taking ownership of the roles. */
+	FCreditsSectionSimple(FCreditsTextObjectSimple&& InTitle, TArray<FCreditsRoleStructSimple>&& InRoles);
+
 	/** reference to the simple text object. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Title"))
 	FCreditsTextObjectSimple Title;
@@ -767,4 +765,8 @@ struct CREDITS_API FCreditsSectionSimple : public FTableRowBase
 	/** reference to the simple credits role. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Roles"))
 	TArray<FCreditsRoleStructSimple> Roles;
+
+	//~ Begin FTableRowBase Interface
+	virtual void OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName) override;
+	//~ End FTableRowBase Interface
 };
\ No newline at end of file
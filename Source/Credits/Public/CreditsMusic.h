@@ -0,0 +1,253 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "CreditsManager.h"
+
+class UAudioComponent;
+class UQuartzClockHandle;
+class UWorld;
+
+/** Simple struct for closing credits music track, a music row placed on the queue clock. */
+struct CREDITS_API FCreditsMusicTrack
+{
+	/** default constructor */
+	FCreditsMusicTrack()
+		: Audio(nullptr)
+		, QueueMode(ECreditsSoundQueueMode::AfterPreviousAudio)
+		, StartTime(0.0f)
+		, PlayDelay(0.0f)
+		, Begin(-1.0)
+		, Duration(0.0)
+		, StartTick(-1.0)
+	{}
+
+	/** Simple constructor */
+	FCreditsMusicTrack(const FCreditsMusic& Music);
+
+	/** Returns whether the track is placed on the queue clock. */
+	bool IsQueued() const
+	{
+		return Begin >= 0.0;
+	}
+
+	/** Returns when the track stops, in seconds on the queue clock. */
+	double GetEnd() const
+	{
+		return Begin + Duration;
+	}
+
+	/** reference to the music wave file. */
+	USoundWave* Audio;
+
+	/** reference to the music queue mode. */
+	ECreditsSoundQueueMode QueueMode;
+
+	/** reference to the seconds into the wave the track starts from. */
+	float StartTime;
+
+	/** reference to the seconds of silence before the track. */
+	float PlayDelay;
+
+	/** reference to when the track starts, in seconds on the queue clock, negative until it is queued. */
+	double Begin;
+
+	/** reference to the seconds the track plays for. */
+	double Duration;
+
+	/** reference to the tick of the queue clock the track was handed to the renderer to start on, negative until then. */
+	double StartTick;
+};
+
+/**
+ * Closing credits playback clock.
+ * Follows the time reported by the audio renderer, which only arrives once per rendered buffer and a frame late, by
+ * running on frame time in between and slewing towards each reported time, so it never steps back or jumps on small
+ * errors. Frame hitches do not make it drift, as the audio keeps playing through them and so does the frame time,
+ * and an error above the snap threshold, from a seek or an audio stall, is caught up at once.
+ */
+class CREDITS_API FCreditsPlaybackClock
+{
+public:
+
+	/** Most the clock runs faster or slower than frame time to catch up with the audio, as a fraction of it. */
+	static const double MaxSlewRate;
+
+	/** Seconds over which an error is slewed away. */
+	static const double SlewSeconds;
+
+	/** Seconds of error above which the clock snaps to the audio. */
+	static const double SnapSeconds;
+
+	FCreditsPlaybackClock()
+		: Time(0.0)
+		, Error(0.0)
+	{}
+
+	/** Sets the clock to Time, forgetting the error. */
+	void Reset(double InTime)
+	{
+		Time = InTime;
+		Error = 0.0;
+	}
+
+	/** Advances the clock by DeltaTime real seconds, slewing towards the last audio time. */
+	void Advance(double DeltaTime);
+
+	/** Takes a time reported by the audio renderer. */
+	void Sync(double AudioTime);
+
+	/** Returns the time of the clock. */
+	double GetTime() const
+	{
+		return Time;
+	}
+
+	/** Returns how far behind the audio the clock is, negative when ahead. */
+	double GetError() const
+	{
+		return Error;
+	}
+
+private:
+
+	/** reference to the time of the clock. */
+	double Time;
+
+	/** reference to the error left to slew away. */
+	double Error;
+};
+
+/**
+ * Closing credits music queue.
+ * Lays the music rows out on a clock, each After Previous Audio track starting where the previous one ends plus its
+ * play delay, from its start time. Tracks are handed to the audio renderer on a Quartz clock a lookahead before they
+ * are due, which precaches them and lets the renderer start them on the exact tick, rather than on the first game
+ * frame after the previous one ended, so consecutive tracks play without a gap. A Do Not Auto Queue track, and the
+ * tracks after it, wait for Play Track, and Skip Audio tracks are never played.
+ */
+class CREDITS_API FCreditsMusicQueue : public FGCObject
+{
+public:
+
+	/** Seconds before a track is due at which it is handed to the audio renderer. */
+	static const float DefaultLookahead;
+
+	/** Ticks per second of the queue clock, the grid tracks start on. */
+	static const float TicksPerSecond;
+
+	FCreditsMusicQueue();
+	virtual ~FCreditsMusicQueue();
+
+	/**
+	 * Starts the queue from its first track.
+	 * @param	InWorld		The world to play the music in
+	 * @param	Music		The music rows, in order
+	 * @param	bInLoop		Whether the queue starts over once the last track ends
+	 * @param	bAutoPlay	Whether the first track plays, otherwise every track waits for Play Track
+	 */
+	void Start(UWorld* InWorld, const TArray<FCreditsMusic>& Music, bool bInLoop, bool bAutoPlay = true);
+
+	/** Advances the queue clock by DeltaTime real seconds, scheduling the tracks due within the lookahead. */
+	void Update(float DeltaTime);
+
+	/** Queues the track at Index, and the tracks following it, to start as soon as they can be scheduled. */
+	void PlayTrack(int32 Index);
+
+	/** Stops scheduling tracks, the scheduled ones still play. */
+	void StopQueueing();
+
+	/** Stops every track and the queue clock. */
+	void Stop();
+
+	/** Sets the volume of every scheduled track. */
+	void SetVolume(float InVolume);
+
+	/** Returns whether a scheduled track has not ended yet. */
+	bool IsPlaying() const
+	{
+		return Components.Num() > 0;
+	}
+
+	/** Returns the seconds on the queue clock, following the playback time of the tracks while they play. */
+	double GetPlaybackTime() const
+	{
+		return Playback.GetTime();
+	}
+
+	/** Returns the queue clock, following the playback time of the tracks while they play. */
+	const FCreditsPlaybackClock& GetPlaybackClock() const
+	{
+		return Playback;
+	}
+
+	/** Returns whether tracks are still being scheduled. */
+	bool IsQueueing() const
+	{
+		return bQueueing;
+	}
+
+	/** Returns the tracks and where they are placed on the queue clock. */
+	const TArray<FCreditsMusicTrack>& GetTracks() const
+	{
+		return Tracks;
+	}
+
+	/**
+	 * Places Tracks on the queue clock from the track at First, starting at Begin, up to the next Do Not Auto Queue
+	 * track, which is left unqueued.
+	 * @return	When the last placed track ends, or Begin when no track was placed
+	 */
+	static double LayOutTracks(TArray<FCreditsMusicTrack>& Tracks, int32 First, double Begin);
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+private:
+
+	/** Hands the track at Index to the audio renderer, to start at its tick on the queue clock. */
+	void ScheduleTrack(int32 Index);
+
+	/** Syncs the queue clock to the playback time of a track, reported once per rendered buffer. */
+	void HandlePlaybackPercent(const UAudioComponent* Component, const USoundWave* Wave, const float Percent);
+
+	/** reference to the world the music plays in. */
+	TWeakObjectPtr<UWorld> World;
+
+	/** reference to the queue clock. */
+	UQuartzClockHandle* Clock;
+
+	/** reference to the tracks of the current pass over the music. */
+	TArray<FCreditsMusicTrack> Tracks;
+
+	/** reference to the component of each scheduled track that has not ended yet. */
+	TArray<UAudioComponent*> Components;
+
+	/** reference to when the track of each component ends, in seconds on the queue clock. */
+	TArray<double> ComponentEnds;
+
+	/** reference to when the wave of each component would have started from its beginning, in seconds on the queue clock. */
+	TArray<double> ComponentOrigins;
+
+	/** reference to the next track to schedule. */
+	int32 NextTrack;
+
+	/** reference to the seconds since the queue started, following the audio while tracks play. */
+	FCreditsPlaybackClock Playback;
+
+	/** reference to when the last scheduled track ends, in seconds on the queue clock. */
+	double ScheduledEnd;
+
+	/** reference to the volume of the tracks. */
+	float Volume;
+
+	/** reference to whether the queue starts over once the last track ends. */
+	bool bLoop;
+
+	/** reference to whether tracks are still being scheduled. */
+	bool bQueueing;
+};
@@ -0,0 +1,158 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Map.h"
+#include "Engine/DataTable.h"
+#include "UObject/GCObject.h"
+#include "UObject/NameTypes.h"
+#include "CreditsManager.h"
+#include "CreditsOverrideIndex.generated.h"
+
+/** Simple key for closing credits overrides, NAME_None acts as a wildcard for the section and role. */
+struct FCreditsOverrideKey
+{
+	FCreditsOverrideKey(const FName& InSection, const FName& InRole, const FName& InName)
+		: Section(InSection)
+		, Role(InRole)
+		, Name(InName)
+	{}
+
+	bool operator==(const FCreditsOverrideKey& Other) const
+	{
+		return Section == Other.Section && Role == Other.Role && Name == Other.Name;
+	}
+
+	friend uint32 GetTypeHash(const FCreditsOverrideKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Section), GetTypeHash(Key.Role)), GetTypeHash(Key.Name));
+	}
+
+	/** reference to the parent section. */
+	FName Section;
+
+	/** reference to the parent role. */
+	FName Role;
+
+	/** reference to the name to override. */
+	FName Name;
+};
+
+/**
+ * Prebuilt index of the section, role and name overrides.
+ * Built once from the override DataTables (or arrays), after which every lookup is a hash probe with no copies.
+ */
+class CREDITS_API FCreditsOverrideIndex : public FGCObject
+{
+public:
+
+	/** Builds the index from the SectionOverrides, RoleOverrides and NameOverrides DataTables, any of which may be null. */
+	void Build(const UDataTable* SectionOverrides, const UDataTable* RoleOverrides, const UDataTable* NameOverrides);
+
+	/** Builds the index from override arrays, as carried by FCreditsOverrides. */
+	void Build(const TArray<FCreditsRoleOverride>& RoleOverrides, const TArray<FCreditsNameOverrides>& NameOverrides);
+
+	/** Adds a section override keyed on the section name. */
+	void AddSectionOverride(const FName& Section, const FCreditsSectionDefaults& OverrideData);
+
+	/** Adds a role override, replacing any previous override for the same section and role. */
+	void AddRoleOverride(const FCreditsRoleOverride& Override);
+
+	/** Adds a name override, replacing any previous override for the same section, role and name. */
+	void AddNameOverride(const FCreditsNameOverrides& Override);
+
+	/** Removes the section override of Section, if any. */
+	void RemoveSectionOverride(const FName& Section);
+
+	/** Removes the role override keyed on (ParentSection, RoleToOverride, NAME_None), if any. */
+	void RemoveRoleOverride(const FCreditsOverrideKey& Key);
+
+	/** Removes the name override keyed on (ParentSection, ParentRole, NameToOverride), if any. */
+	void RemoveNameOverride(const FCreditsOverrideKey& Key);
+
+	/** Removes every override. */
+	void Reset();
+
+	/** Returns the section override for Section, or null. */
+	const FCreditsSectionDefaults* FindSectionOverride(const FName& Section) const;
+
+	/** Returns the role override for Role in Section, falling back to overrides without a parent section, or null. */
+	const FCreditsRoleDefaults* FindRoleOverride(const FName& Section, const FName& Role) const;
+
+	/** Returns the name override for Name in Section/Role, falling back to less specific overrides, or null. */
+	const FCreditsNameTextObject* FindNameOverride(const FName& Section, const FName& Role, const FName& Name) const;
+
+	/**
+	 * Returns how specifically an override keyed on Key applies to Role in Section, following the fallbacks of
+	 * FindRoleOverride: 0 when it does not apply, the more specific the higher.
+	 */
+	static int32 GetRoleOverrideRank(const FName& Section, const FName& Role, const FCreditsOverrideKey& Key);
+
+	/**
+	 * Returns how specifically an override keyed on Key applies to Name in Section/Role, following the fallbacks of
+	 * FindNameOverride: 0 when it does not apply, the more specific the higher.
+	 */
+	static int32 GetNameOverrideRank(const FName& Section, const FName& Role, const FName& Name, const FCreditsOverrideKey& Key);
+
+	/**
+	 * Adds to OutNames every name with an override in Section/Role, with the override FindNameOverride returns for it,
+	 * visiting only the overrides of the scopes it falls back to.
+	 */
+	void GetNameOverridesInScope(const FName& Section, const FName& Role, TMap<FName, const FCreditsNameTextObject*>& OutNames) const;
+
+	/**
+	 * Collects the keys whose override differs between this index and Other, added, removed or changed.
+	 * Section overrides come out as (Section, NAME_None, NAME_None) in OutSectionKeys.
+	 */
+	void GetChangedKeys(const FCreditsOverrideIndex& Other, TArray<FCreditsOverrideKey>& OutSectionKeys, TArray<FCreditsOverrideKey>& OutRoleKeys, TArray<FCreditsOverrideKey>& OutNameKeys) const;
+
+	/** Returns true when no overrides have been added. */
+	bool IsEmpty() const
+	{
+		return SectionOverrides.Num() == 0 && RoleOverrides.Num() == 0 && NameOverrides.Num() == 0;
+	}
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+private:
+
+	/** reference to the section overrides, keyed on the section name. */
+	TMap<FName, FCreditsSectionDefaults> SectionOverrides;
+
+	/** reference to the role overrides, keyed on (ParentSection, RoleToOverride, NAME_None). */
+	TMap<FCreditsOverrideKey, FCreditsRoleDefaults> RoleOverrides;
+
+	/** reference to the name overrides, keyed on (ParentSection, ParentRole, NameToOverride). */
+	TMap<FCreditsOverrideKey, FCreditsNameTextObject> NameOverrides;
+
+	/** reference to the overridden names of each scope, keyed on (ParentSection, ParentRole, NAME_None). */
+	TMap<FCreditsOverrideKey, TArray<FName>> NameScopes;
+};
+
+/** Simple struct for closing credits override index handle, an opaque reference to a prebuilt override index. */
+USTRUCT(BlueprintType)
+struct CREDITS_API FCreditsOverrideIndexHandle
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** default constructor */
+	FCreditsOverrideIndexHandle()
+		: Index()
+	{}
+
+	/** Simple constructor */
+	FCreditsOverrideIndexHandle(TSharedPtr<const FCreditsOverrideIndex> InIndex);
+
+	/** Returns true when the handle references a built index. */
+	bool IsValid() const
+	{
+		return Index.IsValid();
+	}
+
+	/** reference to the override index. */
+	TSharedPtr<const FCreditsOverrideIndex> Index;
+};
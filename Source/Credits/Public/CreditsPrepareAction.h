@@ -0,0 +1,81 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CreditsPreparer.h"
+#include "CreditsPrepareAction.generated.h"
+
+class FCreditsCompiledCredits;
+
+/**
+ * Closing credits prepared by a Prepare Credits action, ready to be handed to a roller.
+ * Keeps the loaded tables and opening images alive for as long as it exists.
+ */
+UCLASS(BlueprintType)
+class CREDITS_API UCreditsPreparedCredits : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Returns the compiled credits, shared by every roller given them. */
+	TSharedPtr<const FCreditsCompiledCredits> GetCompiledCredits() const;
+
+	/** Get Music, the music rows of the prepared credits. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Prepare")
+	TArray<FCreditsMusic> GetMusic() const;
+
+	/** reference to the preparer holding the prepared credits. */
+	TSharedPtr<FCreditsPreparer> Preparer;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FCreditsPrepareActionPin, float, Progress, UCreditsPreparedCredits*, PreparedCredits);
+
+/** Prepares closing credits in the background, see FCreditsPreparer. */
+UCLASS()
+class CREDITS_API UCreditsPrepareAction : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Fires every frame the preparation runs, with its progress from 0 to 1. */
+	UPROPERTY(BlueprintAssignable)
+	FCreditsPrepareActionPin OnProgress;
+
+	/** Fires once the credits are prepared. */
+	UPROPERTY(BlueprintAssignable)
+	FCreditsPrepareActionPin OnCompleted;
+
+	/** Fires if the preparation is cancelled. */
+	UPROPERTY(BlueprintAssignable)
+	FCreditsPrepareActionPin OnCancelled;
+
+	/**
+	 * Prepare Credits, loading and compiling the credits on background threads so showing them is instant.
+	 * @param	Sources		The DataTables to prepare
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Prepare", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UCreditsPrepareAction* PrepareCredits(UObject* WorldContextObject, const FCreditsPrepareSources& Sources);
+
+	/** Cancel, stopping the preparation at its next stage boundary. */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Prepare")
+	void Cancel();
+
+	//~ Begin UBlueprintAsyncActionBase Interface
+	virtual void Activate() override;
+	//~ End UBlueprintAsyncActionBase Interface
+
+private:
+
+	void HandleProgress(float Progress);
+	void HandleFinished(ECreditsPrepareState FinalState);
+
+	/** reference to the sources. */
+	FCreditsPrepareSources Sources;
+
+	/** reference to the preparer. */
+	TSharedPtr<FCreditsPreparer> Preparer;
+};
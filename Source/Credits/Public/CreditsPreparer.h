@@ -0,0 +1,163 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Engine/DataTable.h"
+#include "CreditsManager.h"
+#include "CreditsPreparer.generated.h"
+
+class FCreditsCompiledCredits;
+class FCreditsOverrideIndex;
+struct FStreamableHandle;
+
+/** Simple enum for the stage a closing credits preparation is at. */
+UENUM(BlueprintType)
+enum class ECreditsPrepareState : uint8
+{
+	Idle UMETA( DisplayName = "Idle", ToolTip = "Prepare State - Not started" ),
+	Loading UMETA( DisplayName = "Loading", ToolTip = "Prepare State - Loading the DataTables" ),
+	Compiling UMETA( DisplayName = "Compiling", ToolTip = "Prepare State - Converting and compiling the sections on a worker thread" ),
+	Finalizing UMETA( DisplayName = "Finalizing", ToolTip = "Prepare State - Measuring the lines and rasterizing the glyphs" ),
+	Streaming UMETA( DisplayName = "Streaming", ToolTip = "Prepare State - Loading the opening images" ),
+	Done UMETA( DisplayName = "Done", ToolTip = "Prepare State - Ready to be shown" ),
+	Cancelled UMETA( DisplayName = "Cancelled", ToolTip = "Prepare State - Cancelled before it was done" ),
+};
+
+/** Simple struct for closing credits prepare sources, the DataTables a preparation loads and compiles. */
+USTRUCT(BlueprintType)
+struct CREDITS_API FCreditsPrepareSources
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** default constructor */
+	FCreditsPrepareSources()
+		: PreloadDistance(4000.0f)
+	{}
+
+	/** reference to the sections, FCreditsSection or FCreditsSectionSimple rows. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Sections"))
+	TSoftObjectPtr<UDataTable> Sections;
+
+	/** reference to the section overrides, FCreditsSectionOverride rows, applied to simple sections. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Section Overrides"))
+	TSoftObjectPtr<UDataTable> SectionOverrides;
+
+	/** reference to the role overrides, FCreditsRoleOverride rows, applied to simple sections. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Role Overrides"))
+	TSoftObjectPtr<UDataTable> RoleOverrides;
+
+	/** reference to the name overrides, FCreditsNameOverrides rows, applied to simple sections. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Name Overrides"))
+	TSoftObjectPtr<UDataTable> NameOverrides;
+
+	/** reference to the music, FCreditsMusic rows. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Music"))
+	TSoftObjectPtr<UDataTable> Music;
+
+	/** reference to the distance from the top of the credits within which soft images are loaded up front, negative for every image. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Credits, meta = (DisplayName = "Preload Distance"))
+	float PreloadDistance;
+};
+
+/**
+ * Prepares closing credits ahead of showing them, typically while the loading screen is up.
+ * The DataTables are loaded asynchronously, their overrides indexed and their images sized on the game thread, then
+ * the sections are converted and compiled on a worker thread, then the lines
+ * are measured and their glyphs rasterized on the game thread, and finally the fonts, music and opening images
+ * are loaded. Once done, handing the compiled credits to a roller does no further work.
+ *
+ * Driven by the core ticker, so it progresses on its own once started. Cancelling stops it at the next stage boundary.
+ */
+class CREDITS_API FCreditsPreparer : public TSharedFromThis<FCreditsPreparer>
+{
+public:
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnPrepareProgress, float /*Progress*/);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnPrepareFinished, ECreditsPrepareState /*FinalState*/);
+
+	FCreditsPreparer(const FCreditsPrepareSources& InSources);
+	~FCreditsPreparer();
+
+	/** Starts the preparation. Game thread only. */
+	void Start();
+
+	/** Cancels the preparation, the worker stage stops at its next section. */
+	void Cancel();
+
+	/** Returns the stage the preparation is at. */
+	ECreditsPrepareState GetState() const
+	{
+		return State;
+	}
+
+	/** Returns the fraction of the preparation done, from 0 to 1. */
+	float GetProgress() const;
+
+	/** Returns the compiled credits once done, or null. They are shared by every roller given them, which copy them. */
+	TSharedPtr<const FCreditsCompiledCredits> GetCompiledCredits() const;
+
+	/** Returns the music rows once done. */
+	const TArray<FCreditsMusic>& GetMusic() const
+	{
+		return Music;
+	}
+
+	/** Broadcast on the game thread every frame the preparation runs. */
+	FOnPrepareProgress OnProgress;
+
+	/** Broadcast once on the game thread when the preparation is done or cancelled. */
+	FOnPrepareFinished OnFinished;
+
+private:
+
+	/** Advances the preparation, called by the core ticker. */
+	bool Tick(float DeltaTime);
+
+	/** Converts and compiles the sections one at a time, runs on a worker thread without looking at any object. */
+	void Compile(const UDataTable* SectionsTable, bool bSimpleSections);
+
+	/** Measures the lines, rasterizes the glyphs and requests the assets the opening needs. */
+	void Finalize();
+
+	/** Stops ticking and broadcasts the final state. */
+	void Finish(ECreditsPrepareState FinalState);
+
+	/** reference to the sources. */
+	FCreditsPrepareSources Sources;
+
+	/** reference to the stage the preparation is at. */
+	ECreditsPrepareState State;
+
+	/** reference to the handle keeping the DataTables, and so the fonts and music of their rows, loaded. */
+	TSharedPtr<FStreamableHandle> TablesHandle;
+
+	/** reference to the handle keeping the opening assets loaded. */
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+
+	/** reference to the override index the simple sections are converted with. */
+	TSharedPtr<FCreditsOverrideIndex> Overrides;
+
+	/** reference to the compiled credits. */
+	TSharedPtr<FCreditsCompiledCredits> Compiled;
+
+	/** reference to the music rows. */
+	TArray<FCreditsMusic> Music;
+
+	/** reference to the worker stage. */
+	TFuture<void> CompileTask;
+
+	/** reference to the ticker driving the preparation. */
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** reference to the number of sections the worker stage has compiled. */
+	TAtomic<int32> NumCompiledSections;
+
+	/** reference to the number of sections the worker stage compiles. */
+	TAtomic<int32> NumSections;
+
+	/** reference to whether the preparation was cancelled. */
+	TAtomic<bool> bCancelled;
+};
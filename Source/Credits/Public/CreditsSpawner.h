@@ -1,26 +1,182 @@
-// Fill out your copyright notice in the Description page of Project Settings.
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
 
 #pragma once
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "CreditsCurveTable.h"
+#include "CreditsManager.h"
+#include "CreditsMusic.h"
 #include "CreditsSpawner.generated.h"
 
-UCLASS()
+class UCreditsVirtualRoller;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCreditsRollEnded);
+
+/**
+ * Closing credits driver.
+ * Scrolls a Credits Virtual Roller along the speed curve of its general settings, baked when the roll starts so the
+ * scroll position is the integral of the speed at the roll time, the same at any frame rate. The actor only ticks while a roll
+ * is active, so spawners placed in a level cost nothing until Start Roll, and it can tick at a reduced interval,
+ * the roller then moving the credits on every frame in between at the last speed.
+ * The music rows are played by a FCreditsMusicQueue, which keeps the actor ticking after the roll while it still queues tracks.
+ */
+UCLASS(meta = (DisplayName = "Credits Spawner"))
 class CREDITS_API ACreditsSpawner : public AActor
 {
 	GENERATED_BODY()
-	
-public:	
-	// Sets default values for this actor's properties
+
+public:
+
 	ACreditsSpawner();
 
-protected:
-	// Called when the game starts or when spawned
-	virtual void BeginPlay() override;
+	/** Settings of the roll, the speed curve maps the seconds rolled to credits-space units per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credits", meta = (DisplayName = "General Settings"))
+	FCreditsGeneralSettings GeneralSettings;
+
+	/** Speed used when the settings have no speed curve, in credits-space units per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credits", meta = (ClampMin = "0", DisplayName = "Default Speed"))
+	float DefaultSpeed;
+
+	/** Seconds between two updates of the roll, 0 to update every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (ClampMin = "0", DisplayName = "Roll Tick Interval"))
+	float RollTickInterval;
+
+	/** Whether the roller keeps scrolling between two updates, rather than stepping on every update. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credits", meta = (DisplayName = "Interpolate Scrolling"))
+	bool bInterpolateScrolling;
+
+	/**
+	 * Whether the roll time follows the playback time of the music while it plays, rather than frame time, so
+	 * hitches and time dilation never move the credits away from the soundtrack.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credits", meta = (DisplayName = "Sync To Music"))
+	bool bSyncToMusic;
+
+	/** Music played during the roll when the settings auto play music, in order. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Credits", meta = (DisplayName = "Music"))
+	TArray<FCreditsMusic> Music;
+
+	/** Fires once the credits scrolled past their end, the roll then stops if the settings end credits on end reached. */
+	UPROPERTY(BlueprintAssignable, Category = "Credits")
+	FOnCreditsRollEnded OnRollEnded;
+
+	/**
+	 * Start Roll, scrolling the credits of the roller from the starting position of the settings.
+	 * @param	InRoller	The roller showing the credits
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void StartRoll(UCreditsVirtualRoller* InRoller);
+
+	/** Stop Roll, leaving the credits where they are, the music stopping or carrying on as the settings say. */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void StopRoll();
+
+	/**
+	 * Seek To Time, moving the roll started by Start Roll to a roll time, the scroll position following the speed
+	 * curve up to it. Seeks are a lookup whatever the time, the roller then only shows the lines around the target.
+	 * @param	Time	The seconds into the roll
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void SeekToTime(float Time);
+
+	/**
+	 * Seek To Offset, moving the roll to the time at which it scrolls to a credits-space Y.
+	 * @param	Offset	The credits-space Y to show at the top of the roller
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void SeekToOffset(float Offset);
+
+	/**
+	 * Seek To Section, moving the roll to the time at which it scrolls to the top of a section.
+	 * @param	Section	The title of the section
+	 * @return	Whether the credits hold a section with that title
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	bool SeekToSection(FName Section);
+
+	/**
+	 * Play Music Track, starting a music row and the rows queued after it, typically a Do Not Auto Queue row.
+	 * @param	Index	The index of the row in Music
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void PlayMusicTrack(int32 Index);
+
+	/** Stop Music, stopping the music at once. */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Spawner")
+	void StopMusic();
 
-public:	
-	// Called every frame
+	/** Is Rolling, whether a roll is active. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Spawner")
+	bool IsRolling() const
+	{
+		return bRolling;
+	}
+
+	/** Get Roll Time, the seconds rolled since Start Roll, affected by time dilation if the settings say so. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Spawner")
+	float GetRollTime() const
+	{
+		return RollTime;
+	}
+
+	/** Get Opacity, the value of the opacity curve at the roll time. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Spawner")
+	float GetOpacity() const
+	{
+		return Curves.Opacity.Evaluate(RollTime);
+	}
+
+	/** Get Volume, the value of the music volume curve at the roll time. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Spawner")
+	float GetVolume() const
+	{
+		return Curves.Volume.Evaluate(RollTime);
+	}
+
+	/** Returns the curves of the roll, baked by Start Roll. */
+	const FCreditsRollCurves& GetRollCurves() const
+	{
+		return Curves;
+	}
+
+	//~ Begin AActor Interface
 	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End AActor Interface
+
+private:
+
+	friend class FCreditsMusicDriftTest;
+
+	/** Moves the roll on by RollDeltaTime, or along MusicClock when the roll is synced to a playing one. */
+	void TickRoll(float RollDeltaTime, float TimeDilation, const FCreditsPlaybackClock* MusicClock);
+
+	/** Takes on the move of the scroll offset by the roller, from lazy sections compiled above it. */
+	void FollowRollerOffset();
+
+	/** reference to the roller being driven. */
+	UPROPERTY(Transient)
+	UCreditsVirtualRoller* Roller;
+
+	/** reference to the music queue. */
+	FCreditsMusicQueue MusicQueue;
+
+	/** reference to the baked curves of the roll. */
+	FCreditsRollCurves Curves;
+
+	/** reference to the roll time minus the music playback time, kept across seeks while synced to the music. */
+	double MusicSyncOffset;
+
+	/** reference to the credits-space Y shown at the top of the roller when the roll started. */
+	float StartOffset;
+
+	/** reference to the credits-space Y shown at the top of the roller. */
+	float ScrollOffset;
+
+	/** reference to the seconds rolled since Start Roll. */
+	float RollTime;
 
+	/** reference to whether a roll is active. */
+	bool bRolling;
 };
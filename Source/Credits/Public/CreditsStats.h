@@ -0,0 +1,44 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+
+/**
+ * Closing credits instrumentation.
+ * `stat Credits` shows the time spent in each stage of the credits, from converting the tables to scrolling and
+ * scheduling the music, with the live widgets, visible lines and streamed textures. Each stage is also a scoped
+ * event on the Credits trace channel, which is compiled into every build that has trace, shipping included when
+ * it is enabled for the target, so `-trace=cpu,credits` is enough to profile them in Unreal Insights. The memory
+ * allocated by the plugin is tracked under the Credits LLM tag with `-llm`.
+ */
+DECLARE_STATS_GROUP(TEXT("Credits"), STATGROUP_Credits, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Import"), STAT_CreditsImport, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Convert"), STAT_CreditsConvert, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Compile"), STAT_CreditsCompile, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Recompile"), STAT_CreditsRecompile, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Layout"), STAT_CreditsLayout, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Prepare"), STAT_CreditsPrepare, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Widgets"), STAT_CreditsUpdateWidgets, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Paint"), STAT_CreditsPaint, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Scroll"), STAT_CreditsScroll, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stream Images"), STAT_CreditsStreamImages, STATGROUP_Credits, CREDITS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Schedule Music"), STAT_CreditsScheduleMusic, STATGROUP_Credits, CREDITS_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Widgets"), STAT_CreditsLiveWidgets, STATGROUP_Credits, CREDITS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Visible Lines"), STAT_CreditsVisibleLines, STATGROUP_Credits, CREDITS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Loaded Textures"), STAT_CreditsLoadedTextures, STATGROUP_Credits, CREDITS_API);
+
+LLM_DECLARE_TAG_API(Credits, CREDITS_API);
+
+UE_TRACE_CHANNEL_EXTERN(CreditsChannel, CREDITS_API);
+
+/** Scopes a Credits cycle counter and a Credits trace event of the same name. */
+#define CREDITS_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, CreditsChannel)
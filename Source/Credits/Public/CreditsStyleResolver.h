@@ -0,0 +1,86 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CreditsManager.h"
+#include "CreditsOverrideIndex.h"
+
+/** Simple struct for closing credits style scope, what the role and the names of one role of one section are styled from. */
+struct CREDITS_API FCreditsStyleScope
+{
+	/** reference to the role defaults, its override or the role template. */
+	const FCreditsRoleDefaults* Role = nullptr;
+
+	/** reference to the defaults of every name without an override. */
+	const FCreditsNameTextObject* Name = nullptr;
+
+	/** reference to the override of each overridden name of the scope, the only names ever looked up. */
+	TMap<FName, const FCreditsNameTextObject*> NameDeltas;
+};
+
+/**
+ * Resolves which defaults the closing credits objects are styled from.
+ * A section takes its override or the section template, a role its override for the section or the role
+ * template, and a name its most specific override or the name template. Everything a role and its names need
+ * is resolved once per (section, role) scope and memoized, the name overrides that apply in the scope gathered
+ * into a sparse map, so a name is a single pointer read, or one probe when its scope holds overridden names.
+ */
+class CREDITS_API FCreditsStyleResolver
+{
+public:
+
+	/** Resolves against Overrides, which may be null, and must outlive the resolver. */
+	explicit FCreditsStyleResolver(const FCreditsOverrideIndex* InOverrides);
+
+	/** Returns the defaults of Section. */
+	const FCreditsSectionDefaults& ResolveSection(const FName& Section) const;
+
+	/** Returns the index of the scope of Role in Section, resolving it the first time, not thread safe. */
+	int32 ResolveScope(const FName& Section, const FName& Role);
+
+	/** Returns the scope at ScopeIndex, safe to read from any thread once every scope is resolved. */
+	const FCreditsStyleScope& GetScope(int32 ScopeIndex) const
+	{
+		return Scopes[ScopeIndex];
+	}
+
+	/** Returns the defaults of a name of Scope. */
+	FORCEINLINE const FCreditsNameTextObject& ResolveName(const FCreditsStyleScope& Scope, const FString& Name) const
+	{
+		if (Scope.NameDeltas.Num() == 0)
+		{
+			return *Scope.Name;
+		}
+
+		// a text the name table has never seen cannot have an override, so it is not added to it.
+		const FCreditsNameTextObject* const* Found = Scope.NameDeltas.Find(FName(*Name, FNAME_Find));
+		return Found ? **Found : *Scope.Name;
+	}
+
+	/** Returns the number of resolved scopes. */
+	int32 GetNumScopes() const
+	{
+		return Scopes.Num();
+	}
+
+private:
+
+	/** reference to the overrides, may be null. */
+	const FCreditsOverrideIndex* Overrides;
+
+	/** reference to the defaults of a section without an override. */
+	FCreditsSectionDefaults SectionTemplate;
+
+	/** reference to the defaults of a role without an override. */
+	FCreditsRoleDefaults RoleTemplate;
+
+	/** reference to the defaults of a name without an override. */
+	FCreditsNameTextObject NameTemplate;
+
+	/** reference to the resolved scopes. */
+	TArray<FCreditsStyleScope> Scopes;
+
+	/** reference to the index of each resolved scope, keyed on (Section, Role, NAME_None). */
+	TMap<FCreditsOverrideKey, int32> ScopeLookup;
+};
@@ -0,0 +1,112 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "CreditsManager.h"
+
+class FReferenceCollector;
+
+/** Simple struct for closing credits line style, everything a text object carries besides its text and image. */
+struct CREDITS_API FCreditsLineStyle
+{
+	/** default constructor */
+	FCreditsLineStyle()
+		: Font(nullptr)
+		, FontMaterial(nullptr)
+		, FontSize(24)
+		, Color(1.0f, 1.0f, 1.0f, 1.0f)
+		, Padding()
+		, ImageSizeOverride(false)
+		, ImageSizeProperties(0.0f, 0.0f)
+	{}
+
+	/** Simple constructor */
+	FCreditsLineStyle(const FCreditsTextProperties& InTextProperties, const FCreditsImageProperties& InImageProperties, const FCreditsPaddingMargin& InPadding);
+
+	bool operator==(const FCreditsLineStyle& Other) const;
+
+	/** reference to the font. */
+	UFont* Font;
+
+	/** reference to the font material. */
+	UMaterialInterface* FontMaterial;
+
+	/** reference to the font size. */
+	int32 FontSize;
+
+	/** reference to the font color. */
+	FLinearColor Color;
+
+	/** reference to the padding. */
+	FCreditsPaddingMargin Padding;
+
+	/** reference to the override size. */
+	bool ImageSizeOverride;
+
+	/** reference to the size override. */
+	FVector2D ImageSizeProperties;
+};
+
+CREDITS_API uint32 GetTypeHash(const FCreditsLineStyle& Style);
+
+/**
+ * Interned closing credits styles.
+ * Identical font/size/color/padding combinations share one entry, addressed by a 16-bit index,
+ * and the Slate font of each entry is resolved once when it is interned.
+ */
+class CREDITS_API FCreditsStyleTable
+{
+public:
+
+	/** Returns the index of Style, adding it when it has not been seen yet. */
+	uint16 Intern(const FCreditsLineStyle& Style);
+
+	/** Returns the style at StyleIndex. */
+	FORCEINLINE const FCreditsLineStyle& operator[](uint16 StyleIndex) const
+	{
+		return Styles[StyleIndex];
+	}
+
+	/** Returns the resolved Slate font of the style at StyleIndex. */
+	FORCEINLINE const FSlateFontInfo& GetFontInfo(uint16 StyleIndex) const
+	{
+		return FontInfos[StyleIndex];
+	}
+
+	/** Returns the number of unique styles. */
+	FORCEINLINE int32 Num() const
+	{
+		return Styles.Num();
+	}
+
+	/** Removes every style. */
+	void Reset();
+
+	/**
+	 * Removes the styles not marked in bUsed, keeping the others in order.
+	 * @param	OutRemap	The new index of each style, left as is for a removed one
+	 */
+	void Compact(const TBitArray<>& bUsed, TArray<uint16>& OutRemap);
+
+	/** Returns the memory allocated by the table. */
+	SIZE_T GetAllocatedSize() const;
+
+	/** Reports the fonts and font materials to the garbage collector. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+private:
+
+	/** reference to the unique styles. */
+	TArray<FCreditsLineStyle> Styles;
+
+	/** reference to the Slate font of each style. */
+	TArray<FSlateFontInfo> FontInfos;
+
+	/** reference to the index of each style. */
+	TMap<FCreditsLineStyle, uint16> Lookup;
+
+	/** reference to the index of the last interned style. */
+	int32 LastIndex = INDEX_NONE;
+};
@@ -0,0 +1,66 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "CreditsManager.h"
+
+class UTexture2D;
+
+/** Simple struct for closing credits synthetic generator settings. */
+struct CREDITS_API FCreditsSyntheticSettings
+{
+	/** reference to the number of names. */
+	int32 NumNames = 10000;
+
+	/** reference to the number of names of each role. */
+	int32 NamesPerRole = 50;
+
+	/** reference to the number of roles of each section. */
+	int32 RolesPerSection = 10;
+
+	/** reference to the share of the roles and of the names that are overridden, from 0 to 1. */
+	float OverrideDensity = 0.05f;
+
+	/** reference to the share of the names that show an image, from 0 to 1. */
+	float ImageRatio = 0.01f;
+
+	/** reference to the number of distinct images shown. */
+	int32 NumImages = 16;
+
+	/** reference to the seed of the generator, the same settings always generate the same credits. */
+	int32 Seed = 0;
+};
+
+/**
+ * Synthetic closing credits.
+ * Generates sections, role overrides and name overrides of any size, shaped like a production roll: sections of
+ * roles of names, a share of them restyled by overrides and showing one of a few transient images, to measure the
+ * credits pipeline at scale without assets.
+ */
+struct CREDITS_API FCreditsSyntheticCredits : public FGCObject
+{
+	/** Generates the credits of Settings, replacing the previous ones. */
+	void Generate(const FCreditsSyntheticSettings& Settings);
+
+	/** Returns the number of names generated. */
+	int32 GetNumNames() const;
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	//~ End FGCObject Interface
+
+	/** reference to the sections. */
+	TArray<FCreditsSectionSimple> Sections;
+
+	/** reference to the role overrides. */
+	TArray<FCreditsRoleOverride> RoleOverrides;
+
+	/** reference to the name overrides. */
+	TArray<FCreditsNameOverrides> NameOverrides;
+
+	/** reference to the images shown by the names. */
+	TArray<UTexture2D*> Images;
+};
@@ -0,0 +1,229 @@
+// Copyright (c) 2020 - 2021 Dazzle Software, LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "CreditsManager.h"
+#include "CreditsVirtualRoller.generated.h"
+
+class FCreditsAssetStreamer;
+class FCreditsCompiledCredits;
+class FCreditsIncrementalCompiler;
+class FCreditsLazyCompiler;
+class SCreditsLinePainter;
+class UCreditsImageAtlasAsset;
+class UCreditsPreparedCredits;
+class SCreditsVirtualRoller;
+
+/** Simple enum for how the closing credits roller draws its lines. */
+UENUM(BlueprintType)
+enum class ECreditsRenderMode : uint8
+{
+	Widgets UMETA( DisplayName = "Widgets", ToolTip = "Render Mode - A pooled widget per visible line" ),
+	Painter UMETA( DisplayName = "Painter", ToolTip = "Render Mode - A single widget painting every visible line" ),
+};
+
+/**
+ * Native closing credits roller.
+ * Compiles the credits into a line table and only keeps widgets for the lines around the viewport,
+ * recycling them as the credits scroll, so the widget count stays constant whatever the credits length.
+ * The Painter render mode goes further and draws every visible line from a single widget.
+ * Soft images are only loaded while they are about to be shown, see FCreditsAssetStreamer.
+ */
+UCLASS(meta = (DisplayName = "Credits Virtual Roller"))
+class CREDITS_API UCreditsVirtualRoller : public UWidget
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** Extra distance above and below the viewport in which lines keep their widgets. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (ClampMin = "0", DisplayName = "Viewport Margin"))
+	float ViewportMargin;
+
+	/** Seconds of scrolling ahead of the viewport for which soft images are streamed in. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (ClampMin = "0", DisplayName = "Streaming Lookahead"))
+	float StreamingLookahead;
+
+	/** Extra distance below the viewport margin within which the sections of credits set by Set Lazy Credits are compiled. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (ClampMin = "0", DisplayName = "Lazy Lookahead"))
+	float LazyLookahead;
+
+	/** Whether the glyphs of the credits text are rasterized when the credits are set, rather than as they scroll on screen. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (DisplayName = "Prewarm Glyphs"))
+	bool bPrewarmGlyphs;
+
+	/** Whether the small images of the credits are packed into shared atlas pages when the credits are set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (DisplayName = "Build Image Atlas"))
+	bool bBuildImageAtlas;
+
+	/** An atlas built at cook time, used instead of building one when set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (DisplayName = "Image Atlas"))
+	UCreditsImageAtlasAsset* ImageAtlas;
+
+	/** How the lines are drawn. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Credits", meta = (DisplayName = "Render Mode"))
+	ECreditsRenderMode RenderMode;
+
+	/**
+	 * Set Credits, compiling the sections into the roller and streaming their soft images around the scroll position.
+	 * @param	Sections	The complex credits sections to roll
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetCredits(const TArray<FCreditsSection>& Sections);
+
+	/**
+	 * Set Prepared Credits, rolling credits a Prepare Credits action compiled in the background.
+	 * @param	PreparedCredits	The prepared credits to roll
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetPreparedCredits(UCreditsPreparedCredits* PreparedCredits);
+
+	/**
+	 * Set Live Credits, compiling the sections DataTable into the roller and keeping it up to date as the tables
+	 * are edited, only compiling again the sections a change affects.
+	 * @param	Sections			The DataTable of simple or complex credits sections to roll
+	 * @param	SectionOverrides	The optional DataTable of section overrides
+	 * @param	RoleOverrides		The optional DataTable of role overrides
+	 * @param	NameOverrides		The optional DataTable of name overrides
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetLiveCredits(UDataTable* Sections, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides);
+
+	/**
+	 * Set Lazy Credits, keeping the sections in their simple form and only converting and compiling those around the
+	 * scroll offset, each section being freed again once it scrolled past. Sections not compiled yet take an estimated height.
+	 * Section overrides are looked up by row name, as SetLiveCredits does.
+	 * @param	Sections			The DataTable of simple credits sections to roll
+	 * @param	SectionOverrides	The optional DataTable of section overrides
+	 * @param	RoleOverrides		The optional DataTable of role overrides
+	 * @param	NameOverrides		The optional DataTable of name overrides
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetLazyCredits(UDataTable* Sections, UDataTable* SectionOverrides, UDataTable* RoleOverrides, UDataTable* NameOverrides);
+
+	/** Sets credits that are already compiled, their soft images are not streamed. */
+	void SetCompiledCredits(TSharedPtr<const FCreditsCompiledCredits> InCompiledCredits);
+
+	/** Returns the compiled credits being rolled. */
+	TSharedPtr<const FCreditsCompiledCredits> GetCompiledCredits() const
+	{
+		return CompiledCredits;
+	}
+
+	/**
+	 * Set Scroll Offset. With lazy credits, the sections compiled above the offset move it with the lines under
+	 * it, Get Scroll Offset returning where it ended up.
+	 * @param	InScrollOffset	The credits-space Y shown at the top of the roller
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetScrollOffset(float InScrollOffset);
+
+	/**
+	 * Set Scroll Speed, the speed at which the scroll offset advances every frame until it is set again, letting
+	 * a driver that updates less often than every frame still scroll smoothly.
+	 * @param	InScrollSpeed	The credits-space units scrolled per second, 0 to only move on Set Scroll Offset
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SetScrollSpeed(float InScrollSpeed);
+
+	/**
+	 * Seek To Offset, jumping straight to a credits-space Y. Only the lines around it get widgets and only the soft
+	 * images around it are streamed, however far it is from the current offset.
+	 * @param	Offset	The credits-space Y to show at the top of the roller
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	void SeekToOffset(float Offset);
+
+	/**
+	 * Seek To Section, jumping straight to the top of a section.
+	 * @param	Section	The title of the section
+	 * @return	Whether the credits hold a section with that title
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Credits|Roller")
+	bool SeekToSection(FName Section);
+
+	/**
+	 * Find Section Offset.
+	 * @param	Section		The title of the section
+	 * @param	OutOffset	The credits-space Y of the top of the section
+	 * @return	Whether the credits hold a section with that title
+	 */
+	UFUNCTION(BlueprintPure, Category = "Credits|Roller")
+	bool FindSectionOffset(FName Section, float& OutOffset) const;
+
+	/** Get Current Section, the title of the section at the top of the roller. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Roller")
+	FName GetCurrentSection() const;
+
+	/** Get Scroll Offset, the credits-space Y shown at the top of the roller. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Roller")
+	float GetScrollOffset() const;
+
+	/** Get Total Height of the compiled credits. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Roller")
+	float GetTotalHeight() const;
+
+	/** Get Num Live Widgets, the line widgets currently shown, always 0 in Painter render mode. */
+	UFUNCTION(BlueprintPure, Category = "Credits|Roller")
+	int32 GetNumLiveWidgets() const;
+
+	//~ Begin UVisual Interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~ End UVisual Interface
+
+#if WITH_EDITOR
+	//~ Begin UWidget Interface
+	virtual const FText GetPaletteCategory() override;
+	//~ End UWidget Interface
+#endif
+
+protected:
+
+	//~ Begin UWidget Interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	virtual void SynchronizeProperties() override;
+	//~ End UWidget Interface
+
+private:
+
+	/** Rolls credits compiled and laid out by this roller, packing their images and streaming them in. */
+	void SetOwnedCompiledCredits(const TSharedRef<FCreditsCompiledCredits>& Compiled);
+
+	/** Packs the small images of the credits into atlas pages, if the roller is set to. */
+	void PackImages(FCreditsCompiledCredits& Compiled);
+
+	/** Called after the live or lazy credits were compiled again, with the new index of each image when unused ones were dropped. */
+	void HandleCreditsRecompiled(int32 FirstLine, bool bFullRecompile, const TArray<int32>& ImageRemap);
+
+	/** Moves the asset streaming window to the scroll offset. */
+	void UpdateAssetStreamer();
+
+	/** Compiles the lazy sections coming around the scroll offset and frees those it left behind. */
+	void UpdateLazyCompiler();
+
+	/** reference to the Slate roller. */
+	TSharedPtr<SCreditsVirtualRoller> MyRoller;
+
+	/** reference to the Slate painter. */
+	TSharedPtr<SCreditsLinePainter> MyPainter;
+
+	/** reference to the compiled credits. */
+	TSharedPtr<const FCreditsCompiledCredits> CompiledCredits;
+
+	/** reference to the streamer of the soft images of credits set by SetCredits or SetPreparedCredits. */
+	TSharedPtr<FCreditsAssetStreamer> AssetStreamer;
+
+	/** reference to the compiler keeping the credits set by SetLiveCredits up to date. */
+	TSharedPtr<FCreditsIncrementalCompiler> LiveCompiler;
+
+	/** reference to the compiler of the sections of credits set by SetLazyCredits. */
+	TSharedPtr<FCreditsLazyCompiler> LazyCompiler;
+
+	/** reference to the credits-space Y shown at the top of the roller. */
+	float ScrollOffset;
+
+	/** reference to the speed at which the scroll offset advances every frame. */
+	float ScrollSpeed;
+};